@@ -37,6 +37,9 @@ using namespace std;
 // include for NLP
 #include "remo/moRealTypes.h"
 #include "reeo/src/algo/PopulationSearchManager.h"
+#include "reeo/src/algo/PopulationSearchManagerCMAES.h"
+#include "reeo/src/algo/PopulationSearchManagerBO.h"
+#include "reeo/src/algo/PopulationSearchManagerPSO.h"
 
 // objective functions 
 #include "objfunc/simple/SimpleObj.h"
@@ -104,6 +107,39 @@ void main_function(int argc, char **argv)
   eamanager.init(3,1.0);
   eamanager.run();
 
+
+  PopulationSearchManagerCMAES<ObjFunc> cmamanager(lowBound,uppBound,0,100000,seed);
+
+  cmamanager.setMaxFuncEval(100000);
+  cmamanager.setIPOP(5,2.0);
+
+  cmamanager.init();
+  cmamanager.run();
+  cmamanager.printOn();
+
+
+  // for expensive objectives: 4 points per batch evaluated concurrently
+  PopulationSearchManagerBO<ObjFunc> bomanager(lowBound,uppBound,0,100000,seed);
+
+  bomanager.setMaxFuncEval(200);
+  bomanager.setBatchSize(4);
+
+  bomanager.init();
+  bomanager.run();
+  bomanager.printOn();
+
+
+  // particle swarm, particles are moved and evaluated without generational barrier
+  PopulationSearchManagerPSO<ObjFunc> psomanager(lowBound,uppBound,40,1000,seed);
+
+  psomanager.setMaxFuncEval(20000);
+  psomanager.setRingTopology();
+  psomanager.setAsynchronous();
+
+  psomanager.init();
+  psomanager.run();
+  psomanager.printOn();
+
 }
 
 // A main that catches the exceptions
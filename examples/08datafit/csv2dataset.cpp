@@ -0,0 +1,54 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/ 
+
+/**
+ * \file  csv2dataset.cpp
+ *  
+ * One-shot converter of a CSV file into a memory mapped dataset 
+ * (@see util/MappedDataset.h) 
+ * 
+ *   csv2dataset.exe data.csv data.bbd [delimiter] 
+ * 
+ * @date: Oct. 2026
+ */ 
+
+using namespace std;
+
+#include <iostream>
+#include "util/MappedDataset.h"
+
+int main(int argc, char **argv)
+{
+  if(argc < 3) {
+    cout << "usage: " << argv[0] << " data.csv data.bbd [delimiter]" << endl;
+    return 1;
+  }
+  char delimiter = argc > 3 ? argv[3][0] : ',';
+  if(!MappedDataset::convertCSV(argv[1],argv[2],delimiter)) 
+    return 1;
+
+  MappedDataset data; 
+  data.open(argv[2]);
+  cout << argv[2] << " : " << data.rows() << " rows, columns :";
+  for(unsigned int j=0;j<data.numColumns();j++) 
+    cout << " " << data.name(j);
+  cout << endl;
+  return 0;
+}
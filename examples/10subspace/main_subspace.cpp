@@ -0,0 +1,94 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015 
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/ 
+
+/**
+ * \file  main_subspace.cpp
+ *  
+ * Main driver for a hill climbing in random subspaces of a very high 
+ * dimensional objective function with incremental evaluation 
+ * 
+ * @date: Oct. 2026
+ */ 
+
+// declaration of the namespace
+using namespace std;
+
+// the general include for eo
+#include <eo>
+
+// include for NLP
+#include "remo/moRealTypes.h"
+
+// objective functions with incremental evaluation (RSRRMVOF::evalIncremental)
+#include "objfunc/rastrigin/Rastrigin.h"
+//#include "objfunc/rosenbrock/Rosenbrock.h"
+//#include "objfunc/simple/SimpleObj.h"
+
+typedef Rastrigin ObjFunc;
+//typedef Rosenbrock ObjFunc;
+//typedef SimpleObj ObjFunc;
+
+// include for solution initialization
+#include "util/Utilities.h"
+
+void main_function(int argc, char **argv)
+{
+  unsigned N = 100000;     // dimension 
+  unsigned D = 16;         // dimension of the subspaces 
+
+  vector<double> lowBounds(N,-5.12),uppBounds(N,5.12); 
+  EORVT solution; 
+  Utilities::getRandomSolution(solution,lowBounds,uppBounds);
+
+  ObjFunc objective; 
+  GoalFuncCounter eval(objective); 
+  eval(solution);
+  cout << "Initial value : " << solution.fitness() << "\n"; 
+
+  // 50 neighbors per iteration, each moving D random coordinates 
+  SubspaceNeighborhood neighborhood(50,0.5,D);
+  neighborhood.setBounds(lowBounds,uppBounds);
+
+  // neighbors are evaluated in O(D) by the objective's incremental evaluation 
+  moIncrementalEval<SubspaceNeighbor,ObjFunc> neighborEval(objective,eval);
+
+  SubspaceHillClimbing hc(neighborhood,eval,neighborEval);
+  moFullEvalContinuator<SubspaceNeighbor> maxeval(eval,1000000);
+  hc.setContinuator(maxeval);
+
+  hc(solution);
+
+  cout << "Final value : " << solution.fitness() << "\n"; 
+  cout << " obj func cntr : " << eval.value() 
+       << " (incremental : " << neighborEval.getNumIncremental() << ")" << std::endl;
+}
+
+
+// A main that catches the exceptions
+int main(int argc, char **argv)
+{
+    try {
+        main_function(argc, argv);
+    }
+    catch (exception& e) {
+        cout << "Exception: " << e.what() << '\n';
+    }
+    return 1;
+}
@@ -0,0 +1,199 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+/**
+ * \file  main_allocation.cpp
+ *
+ * Main driver checking that the local search loop (neighborhood,
+ * evaluation and continuators) does not allocate heap memory after the
+ * first iteration. The global operator new is replaced by a counting one,
+ * the program fails if an allocation happens after the warm-up
+ * (make check).
+ *
+ * @date: Oct. 2026
+ */
+
+// declaration of the namespace
+using namespace std;
+
+#include <new>
+#include <cstdlib>
+
+// the general include for eo
+#include <eo>
+
+// include for NLP
+#include "remo/moRealTypes.h"
+#include "remo/src/algo/localSearchManager.h"
+
+// objective functions
+#include "objfunc/simple/SimpleObj.h"
+#include "objfunc/griewank/Griewank.h"
+#include "objfunc/rastrigin/Rastrigin.h"
+#include "objfunc/rosenbrock/Rosenbrock.h"
+#include "objfunc/expression/ExpressionObj.h"
+
+// include for solution initialization
+#include "util/Utilities.h"
+
+/* =========================================================
+ *
+ * counting allocator
+ *
+ * ========================================================= */
+
+static volatile unsigned long numAllocations = 0;
+
+static void* allocate(std::size_t _size) {
+  __sync_fetch_and_add(&numAllocations,1UL);
+  void* p = std::malloc(_size == 0 ? 1 : _size);
+  if(p == 0) throw std::bad_alloc();
+  return p;
+}
+
+// dynamic exception specifications are removed in C++17
+#if __cplusplus >= 201103L
+#define THROW_BAD_ALLOC
+#define NO_THROW noexcept
+#else
+#define THROW_BAD_ALLOC throw(std::bad_alloc)
+#define NO_THROW throw()
+#endif
+
+void* operator new(std::size_t _size) THROW_BAD_ALLOC { return allocate(_size); }
+void* operator new[](std::size_t _size) THROW_BAD_ALLOC { return allocate(_size); }
+void* operator new(std::size_t _size,const std::nothrow_t&) NO_THROW {
+  __sync_fetch_and_add(&numAllocations,1UL);
+  return std::malloc(_size == 0 ? 1 : _size);
+}
+void* operator new[](std::size_t _size,const std::nothrow_t& _nt) NO_THROW { return operator new(_size,_nt); }
+void operator delete(void* _p) NO_THROW { std::free(_p); }
+void operator delete[](void* _p) NO_THROW { std::free(_p); }
+void operator delete(void* _p,const std::nothrow_t&) NO_THROW { std::free(_p); }
+void operator delete[](void* _p,const std::nothrow_t&) NO_THROW { std::free(_p); }
+
+/**
+ * \class AllocationCheck
+ *
+ * Continuator counting the heap allocations of the iterations after the
+ * warm-up (the first iteration)
+ */
+class AllocationCheck : public moContinuator<Neighbor> {
+
+public:
+
+  /**
+   * Cor.
+   *
+   * @param _warmup  num. of iterations which may allocate
+   */
+  AllocationCheck(unsigned int _warmup=1) : warmup(_warmup),iter(0),start(0),allocations(0) { }
+
+  virtual void init(EORVT& _solution) {
+    iter = 0;
+    allocations = 0;
+  }
+
+  virtual bool operator()(EORVT& _solution) {
+    if(++iter == warmup) start = numAllocations;
+    return true;
+  }
+
+  virtual void lastCall(EORVT& _solution) {
+    if(iter >= warmup) allocations = numAllocations - start;
+  }
+
+  /// @return num. of allocations after the warm-up
+  unsigned long getNumAllocations() const {
+    return allocations;
+  }
+
+  /// @return num. of iterations
+  unsigned int getNumIterations() const {
+    return iter;
+  }
+
+private:
+
+  unsigned int  warmup;       ///> num. of warm-up iterations
+  unsigned int  iter;         ///> num. of iterations
+  unsigned long start;        ///> allocation counter after the warm-up
+  unsigned long allocations;  ///> allocations after the warm-up
+
+};
+
+/**
+ * run a local search and report the allocations after the warm-up
+ *
+ * @return num. of allocations after the warm-up
+ */
+template<class LocalSearch,class ObjFunc>
+unsigned long check(const EORVT& _initial,const std::string& _name) {
+  AllocationCheck allocations;
+  LocalSearchManager<LocalSearch,ObjFunc> manager(_initial,20,0.1,500);
+  manager.addContinuator(allocations);
+  manager.init(20000);
+  manager.run();
+  cout << _name << " : " << allocations.getNumAllocations() << " allocations in "
+       << allocations.getNumIterations() << " iterations" << endl;
+  return allocations.getNumAllocations();
+}
+
+int main_function(int argc, char **argv)
+{
+  unsigned N = 50;  // dimension
+  vector<double> lowBounds(N,-5),uppBounds(N,5);
+  EORVT initialSolution;
+  Utilities::getRandomSolution(initialSolution,lowBounds,uppBounds);
+
+  unsigned long allocations = 0;
+  allocations += check<SimpleHillClimbing,SimpleObj>(initialSolution,"SimpleObj HC");
+  allocations += check<SimpleHillClimbing,Rosenbrock>(initialSolution,"Rosenbrock HC");
+  allocations += check<FirstImprHillClimbing,Rastrigin>(initialSolution,"Rastrigin first impr. HC");
+  allocations += check<FirstImprHillClimbing,Griewank>(initialSolution,"Griewank first impr. HC");
+
+  // an unrolled sum over more variables than registers on the stack
+  unsigned M = 1000;
+  vector<double> lowBoundsM(M,-5),uppBoundsM(M,5);
+  EORVT largeSolution;
+  Utilities::getRandomSolution(largeSolution,lowBoundsM,uppBoundsM);
+  ExpressionObj::configure("sum(i,0,n-1,(i+1)*x[i]^2)");
+  allocations += check<SimpleHillClimbing,ExpressionObj>(largeSolution,"sum(i,0,n-1,(i+1)*x[i]^2) HC");
+
+  if(allocations > 0) {
+    cout << "FAILED : the local search allocates in the steady state" << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
+
+
+// A main that catches the exceptions
+int main(int argc, char **argv)
+{
+    try {
+        return main_function(argc, argv);
+    }
+    catch (exception& e) {
+        cout << "Exception: " << e.what() << '\n';
+    }
+    return 1;
+}
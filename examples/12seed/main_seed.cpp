@@ -0,0 +1,175 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+/**
+ * \file  main_seed.cpp
+ *
+ * Main driver for a hill climbing with seed neighbors: the neighbors are
+ * stored as keys and their offsets are regenerated by move() and
+ * moveBack(). The program checks that a move is undone exactly, that the
+ * keys of a finite pool of streams recur (as needed by a tabu list) and
+ * that each neighbor costs one evaluation, and compares the run time with
+ * the hill climbing over vector neighbors.
+ *
+ * @date: Oct. 2026
+ */
+
+// declaration of the namespace
+using namespace std;
+
+#include <ctime>
+#include <cmath>
+
+// the general include for eo
+#include <eo>
+
+// include for NLP
+#include "remo/moRealTypes.h"
+
+// objective functions
+#include "objfunc/simple/SimpleObj.h"
+//#include "objfunc/rastrigin/Rastrigin.h"
+
+typedef SimpleObj ObjFunc;
+//typedef Rastrigin ObjFunc;
+
+// include for solution initialization
+#include "util/Utilities.h"
+
+/**
+ * \class NeighborCounter
+ *
+ * neighbor evaluation counting its calls
+ */
+template<class Neighbor>
+class NeighborCounter : public moEval<Neighbor> {
+
+public:
+
+  typedef typename Neighbor::EOT EOT;
+
+  NeighborCounter(moEval<Neighbor>& _eval) : eval(_eval),calls(0) { }
+
+  virtual void operator()(EOT& _solution,Neighbor& _neighbor) {
+    calls++;
+    eval(_solution,_neighbor);
+  }
+
+  /// @return num. of evaluated neighbors
+  unsigned long getNumCalls() const {
+    return calls;
+  }
+
+private:
+
+  moEval<Neighbor>& eval;   ///> wrapped neighbor evaluation
+  unsigned long     calls;  ///> num. of evaluated neighbors
+
+};
+
+/**
+ * run a hill climbing
+ *
+ * @return false if the evaluations are not one per neighbor
+ */
+template<class LocalSearch,class Neighborhood,class Neighbor>
+bool run(const std::string& _name,Neighborhood& _neighborhood,const EORVT& _initial,unsigned long _maxeval) {
+  ObjFunc objective;
+  GoalFuncCounter eval(objective);
+  EORVT solution(_initial);
+  eval(solution);
+  unsigned long before = eval.value();
+
+  moFullEvalByModif<Neighbor> fullNeighborEval(eval);
+  NeighborCounter<Neighbor> neighborEval(fullNeighborEval);
+  LocalSearch hc(_neighborhood,eval,neighborEval);
+  moFullEvalContinuator<Neighbor> maxeval(eval,_maxeval);
+  hc.setContinuator(maxeval);
+
+  clock_t start = clock();
+  hc(solution);
+  double time = double(clock() - start) / CLOCKS_PER_SEC;
+
+  cout << _name << " : value " << solution.fitness() << " obj func cntr " << eval.value() - before
+       << " evaluated neighbors " << neighborEval.getNumCalls() << " time " << time << "s" << endl;
+  return eval.value() - before == neighborEval.getNumCalls();
+}
+
+int main_function(int argc, char **argv)
+{
+  unsigned N = 20000;           // dimension
+  unsigned long maxeval = 5000; // evaluations of each run
+
+  vector<double> lowBounds(N,-1),uppBounds(N,1);
+  EORVT initialSolution;
+  Utilities::getRandomSolution(initialSolution,lowBounds,uppBounds);
+
+  // move() followed by moveBack() restores the solution
+  SeedNeighborhood seedNeighborhood(50,0.01);
+  SeedNeighbor neighbor;
+  EORVT moved(initialSolution);
+  seedNeighborhood.init(moved,neighbor);
+  neighbor.move(moved);
+  double shift = 0.0;
+  for(unsigned i=0;i<N;i++) shift = std::max(shift,std::fabs(moved[i] - initialSolution[i]));
+  neighbor.moveBack(moved);
+  double error = 0.0;
+  for(unsigned i=0;i<N;i++) error = std::max(error,std::fabs(moved[i] - initialSolution[i]));
+  cout << "max. offset " << shift << " , max. error after moveBack " << error << endl;
+  bool ok = shift > 0.0 && shift <= 0.01 && error < 1e-12;
+
+  // with a pool of one stream each iteration enumerates the same moves,
+  // the second neighbor is the reverse of the first one
+  SeedNeighborhood pooledNeighborhood(50,0.01);
+  pooledNeighborhood.setNumStreams(1);
+  SeedNeighbor first,reverse,again;
+  EORVT solution(initialSolution);
+  pooledNeighborhood.init(solution,first);
+  pooledNeighborhood.next(solution,reverse);
+  pooledNeighborhood.init(solution,again);
+  first.move(solution);
+  reverse.move(solution);
+  error = 0.0;
+  for(unsigned i=0;i<N;i++) error = std::max(error,std::fabs(solution[i] - initialSolution[i]));
+  bool recognized = first.equals(again) && first.equals(reverse) && !first.equals(neighbor);
+  cout << "keys recognized " << (recognized ? "yes" : "no") << " , max. error after the reverse move " << error << endl;
+  ok = ok && recognized && error < 1e-12;
+
+  // one evaluation per neighbor, the offsets are regenerated without evaluations
+  ok = run<SeedHillClimbing,SeedNeighborhood,SeedNeighbor>("seed neighbors",seedNeighborhood,initialSolution,maxeval) && ok;
+  Neighborhood neighborhood(50,0.01);
+  ok = run<SimpleHillClimbing,Neighborhood,Neighbor>("vector neighbors",neighborhood,initialSolution,maxeval) && ok;
+
+  cout << (ok ? "OK" : "FAILED") << endl;
+  return ok ? 0 : 1;
+}
+
+
+// A main that catches the exceptions
+int main(int argc, char **argv)
+{
+    try {
+        return main_function(argc, argv);
+    }
+    catch (exception& e) {
+        cout << "Exception: " << e.what() << '\n';
+    }
+    return 1;
+}
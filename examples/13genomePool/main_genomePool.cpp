@@ -0,0 +1,119 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+/**
+ * \file  main_genomePool.cpp
+ *
+ * Main driver for the generation loop of an evolutionary algorithm with
+ * the genome buffers recycled by a GenomePool (selection by
+ * eoPooledSelectPerc, replacement by eoPooledReplacement). The program
+ * checks that after the warm-up each selected offspring gets a recycled
+ * buffer and that the pool never holds more than one population.
+ *
+ * @date: Oct. 2026
+ */
+
+// declaration of the namespace
+using namespace std;
+
+// the general include for eo
+#include <eo>
+
+// include for NLP
+#include "remo/moRealTypes.h"
+#include "reeo/src/algo/eoPooledSelectPerc.h"
+#include "reeo/src/algo/eoPooledReplacement.h"
+
+// objective functions
+#include "objfunc/simple/SimpleObj.h"
+//#include "objfunc/rastrigin/Rastrigin.h"
+
+typedef SimpleObj ObjFunc;
+//typedef Rastrigin ObjFunc;
+
+// include for solution initialization
+#include "util/Utilities.h"
+
+int main_function(int argc, char **argv)
+{
+  unsigned N = 1000;         // dimension
+  unsigned POP_SIZE = 50;    // population size
+  unsigned MAX_GEN = 100;    // num. of generations
+  unsigned WARMUP = 1;       // generations before the pool is filled
+
+  ObjFunc objective;
+  GoalFuncCounter eval(objective);
+
+  vector<double> lowBounds(N,-5),uppBounds(N,5);
+  eoPop<EORVT> pop;
+  pop.resize(POP_SIZE);
+  for(unsigned i=0;i<POP_SIZE;i++) {
+    Utilities::getRandomSolution(pop[i],lowBounds,uppBounds);
+    eval(pop[i]);
+  }
+
+  GenomePool pool;
+  eoDetTournamentSelect<EORVT> selectOne(2);
+  eoPooledSelectPerc select(selectOne,pool);
+  eoNormalMutation<EORVT> mutation(0.1);
+  eoGenerationalReplacement<EORVT> generational;
+  eoPooledReplacement replace(generational,pool);
+
+  // the generation loop of eoEasyEA with a mutation as variation
+  eoPop<EORVT> offspring;
+  unsigned long acquired = 0,recycled = 0;
+  for(unsigned gen=0;gen<MAX_GEN;gen++) {
+    if(gen == WARMUP) {
+      acquired = pool.getNumAcquired();
+      recycled = pool.getNumRecycled();
+    }
+    select(pop,offspring);
+    for(unsigned i=0;i<offspring.size();i++) {
+      if(mutation(offspring[i])) offspring[i].invalidate();
+      if(offspring[i].invalid()) eval(offspring[i]);
+    }
+    replace(pop,offspring);
+  }
+  acquired = pool.getNumAcquired() - acquired;
+  recycled = pool.getNumRecycled() - recycled;
+
+  // the pool holds the discarded population of one generation
+  unsigned long bound = POP_SIZE * N * sizeof(double);
+  cout << "best " << pop.best_element().fitness() << " after " << MAX_GEN << " generations" << endl;
+  cout << "recycled genomes after the warm-up : " << recycled << " of " << acquired << endl;
+  cout << "high-water mark : " << pool.getHighWaterMark() << " bytes (bound " << bound << " bytes)" << endl;
+
+  bool ok = acquired > 0 && recycled == acquired && pool.getHighWaterMark() <= bound;
+  cout << (ok ? "OK" : "FAILED") << endl;
+  return ok ? 0 : 1;
+}
+
+
+// A main that catches the exceptions
+int main(int argc, char **argv)
+{
+    try {
+        return main_function(argc, argv);
+    }
+    catch (exception& e) {
+        cout << "Exception: " << e.what() << '\n';
+    }
+    return 1;
+}
@@ -0,0 +1,268 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _DataFitObj_h
+#define _DataFitObj_h
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cmath>
+#include <stdexcept>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "../eoObjFunc.h"
+#include "util/MappedDataset.h"
+#include "util/LinearAlgebra.h"
+
+/**
+ * \file DataFitObj.h
+ * \class DataFitObj
+ *
+ * Base class of parameter estimation problems against a measured time
+ * series in a memory mapped dataset (@see MappedDataset). The objective is
+ * the (weighted) sum of squared residuals between the model output and the
+ * measured output column:
+ *
+ *   f(p) = sum_i w_i (model(p,i) - y_i)^2
+ *
+ * Subclasses implement model() for a chunk of consecutive rows. The rows
+ * are processed in chunks of CHUNK rows s.t. the model output stays in the
+ * cache. Long series (>= parallel rows) are evaluated by the OpenMP worker
+ * pool unless the evaluation itself runs in a parallel region (e.g. from
+ * ParallelEval). The bounded evaluation stops after the first chunk whose
+ * partial sum exceeds the cutoff.
+ *
+ * The residuals (@see RSRRMVOF::residuals()) are the weighted differences
+ * of the rows, s.t. least squares methods can be applied.
+ *
+ * The dataset is mapped once per process and shared by all instances.
+ * Objectives constructed by the managers (default constructor) use the
+ * dataset set by DataFitObj::configure(). A dataset which cannot be mapped
+ * or an unknown column throws std::runtime_error; without a dataset every
+ * point evaluates to HUGE_VAL and residuals() throws.
+ *
+ * @date: Oct. 2026
+ */
+class DataFitObj : public RSRRMVOF {
+
+public:
+
+  /** number of rows per chunk */
+  static const unsigned long CHUNK = 2048;
+
+  /**
+   * Cor. with the dataset of configure()
+   */
+  DataFitObj() : data(0),input(0),output(0),weight(0),parallelRows(1UL << 18) {
+    open(defaults().file,defaults().input,defaults().output,defaults().weight);
+  }
+
+  /**
+   * Cor.
+   *
+   * @param _file    dataset file
+   * @param _input   name (or number) of the input column, e.g. time (empty: none)
+   * @param _output  name (or number) of the measured output column
+   * @param _weight  name (or number) of the weight column (empty: none)
+   */
+  DataFitObj(const std::string& _file,const std::string& _input,const std::string& _output,const std::string& _weight="")
+    : data(0),input(0),output(0),weight(0),parallelRows(1UL << 18) {
+    open(_file,_input,_output,_weight);
+  }
+
+  /**
+   * set the dataset of default constructed objectives
+   *
+   * @param _file    dataset file
+   * @param _input   name (or number) of the input column, e.g. time (empty: none)
+   * @param _output  name (or number) of the measured output column
+   * @param _weight  name (or number) of the weight column (empty: none)
+   */
+  static void configure(const std::string& _file,const std::string& _input,const std::string& _output,const std::string& _weight="") {
+    defaults().file = _file;
+    defaults().input = _input;
+    defaults().output = _output;
+    defaults().weight = _weight;
+  }
+
+  /// @return the dataset (0: none)
+  const MappedDataset* getData() const {
+    return data;
+  }
+
+  /// @return number of rows of the time series
+  unsigned long long rows() const {
+    return data == 0 ? 0 : data->rows();
+  }
+
+  /**
+   * @param _name name (or number) of a column
+   * @return the column, 0 if there is none
+   */
+  const double* getColumn(const std::string& _name) const {
+    int j = data == 0 ? -1 : data->columnIndex(_name);
+    return j < 0 ? 0 : data->column(j);
+  }
+
+  /// @return the class name, the dataset file and the columns
+  virtual std::string identity() const {
+    return RSRRMVOF::identity() + ":" + source;
+  }
+
+  /// series of at least _rows rows are evaluated in parallel
+  void setParallelRows(unsigned long long _rows) {
+    parallelRows = _rows;
+  }
+
+  /// one residual per row
+  virtual unsigned long numResiduals(unsigned int _dimension) {
+    return (unsigned long) rows();
+  }
+
+  /**
+   * weighted residuals sqrt(w_i) (model(p,i) - y_i) of all rows
+   *
+   * @param _arg  parameters
+   * @param _r    residuals
+   */
+  virtual void residuals(const std::vector<double>& _arg,std::vector<double>& _r) {
+    if(data == 0)
+      throw std::runtime_error("DataFitObj: no dataset, see DataFitObj::configure()");
+    _r.resize(rows());
+    long chunks = (long) ((rows() + CHUNK - 1) / CHUNK);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(rows() >= parallelRows && !omp_in_parallel())
+#endif
+    for(long c=0;c<chunks;c++) {
+      unsigned long long begin = (unsigned long long) c * CHUNK;
+      unsigned long n = (unsigned long) std::min<unsigned long long>(CHUNK,data->rows() - begin);
+      double* out = &_r[begin];
+      model(_arg,begin,n,out);
+      for(unsigned long i=0;i<n;i++) out[i] -= output[begin+i];
+      if(weight != 0)
+	for(unsigned long i=0;i<n;i++) out[i] *= std::sqrt(weight[begin+i]);
+    }
+  }
+
+protected:
+
+  /**
+   * model output of the rows [_begin,_begin+_n[, must be reentrant
+   *
+   * @param _params  parameters
+   * @param _begin   first row
+   * @param _n       number of rows (<= CHUNK)
+   * @param _out     model output
+   */
+  virtual void model(const std::vector<double>& _params,unsigned long long _begin,unsigned long _n,double* _out) const=0;
+
+  virtual double eval(const std::vector<double>& _arg) {
+    double sum;
+    evalBounded(_arg,HUGE_VAL,sum);
+    return sum;
+  }
+
+  virtual bool evalBounded(const std::vector<double>& _arg,double _cutoff,double& _sum) {
+    _sum = 0.0;
+    if(data == 0) {
+      // no dataset: no point is a fit
+      _sum = HUGE_VAL;
+      return false;
+    }
+    unsigned long long n = data->rows();
+    long chunks = (long) ((n + CHUNK - 1) / CHUNK);
+#ifdef _OPENMP
+    if(n >= parallelRows && !omp_in_parallel() && omp_get_max_threads() > 1) {
+      // partial sums per chunk are added in order, s.t. the result does not
+      // depend on the number of threads; the buffer is reused by the next
+      // evaluations (this branch is never entered from a parallel region)
+      partial.resize(chunks);
+#pragma omp parallel
+      {
+	double out[CHUNK];
+#pragma omp for schedule(static)
+	for(long c=0;c<chunks;c++)
+	  partial[c] = residual(_arg,c,out);
+      }
+      for(long c=0;c<chunks;c++) _sum += partial[c];
+      return true;
+    }
+#endif
+    double out[CHUNK];
+    for(long c=0;c<chunks;c++) {
+      _sum += residual(_arg,c,out);
+      if(_sum > _cutoff) return false;
+    }
+    return true;
+  }
+
+  /// weighted sum of squared residuals of chunk c
+  double residual(const std::vector<double>& _arg,long _c,double* _out) const {
+    unsigned long long begin = (unsigned long long) _c * CHUNK;
+    unsigned long n = (unsigned long) std::min<unsigned long long>(CHUNK,data->rows() - begin);
+    model(_arg,begin,n,_out);
+    if(weight != 0)
+      return LinearAlgebra::sumSquaredDiff(_out,output + begin,weight + begin,n);
+    return LinearAlgebra::sumSquaredDiff(_out,output + begin,n);
+  }
+
+  const MappedDataset*  data;          ///> shared dataset
+  const double*         input;         ///> input column (0: none)
+  const double*         output;        ///> measured output column
+  const double*         weight;        ///> weight column (0: none)
+  unsigned long long    parallelRows;  ///> min. number of rows for parallel evaluation
+  std::vector<double>   partial;       ///> partial sums of the chunks
+  std::string           source;        ///> dataset file and columns
+
+private:
+
+  /// dataset of default constructed objectives
+  struct Defaults {
+    std::string file, input, output, weight;
+  };
+
+  static Defaults& defaults() {
+    static Defaults d;
+    return d;
+  }
+
+  /// map the dataset and look up the columns
+  void open(const std::string& _file,const std::string& _input,const std::string& _output,const std::string& _weight) {
+    if(_file.empty()) return;
+    source = _file + ":" + _input + ":" + _output + ":" + _weight;
+    data = MappedDataset::shared(_file);
+    if(data == 0)
+      throw std::runtime_error("DataFitObj: " + _file + " is not a dataset, see MappedDataset::convertCSV()");
+    input = _input.empty() ? 0 : getColumn(_input);
+    output = getColumn(_output);
+    weight = _weight.empty() ? 0 : getColumn(_weight);
+    if(output == 0 || (!_input.empty() && input == 0) || (!_weight.empty() && weight == 0)) {
+      data = 0;
+      throw std::runtime_error("DataFitObj: unknown column in " + _file);
+    }
+    INITIALIZED = true;
+  }
+};
+
+#endif
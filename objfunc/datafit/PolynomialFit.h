@@ -0,0 +1,74 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _PolynomialFit_h
+#define _PolynomialFit_h
+
+#include "DataFitObj.h"
+
+/**
+ * \file PolynomialFit.h
+ * \class PolynomialFit
+ *
+ * Least squares fit of a polynomial y(t) = p_0 + p_1 t + ... + p_{n-1} t^{n-1}
+ * to a measured time series, a minimal example of a DataFitObj
+ *
+ * @date: Oct. 2026
+ */
+class PolynomialFit : public DataFitObj {
+
+public:
+
+  /// Cor. with the dataset of DataFitObj::configure()
+  PolynomialFit() { }
+
+  /**
+   * Cor.
+   *
+   * @param _file    dataset file
+   * @param _input   name (or number) of the input column t (empty: row number)
+   * @param _output  name (or number) of the measured output column y
+   * @param _weight  name (or number) of the weight column (empty: none)
+   */
+  PolynomialFit(const std::string& _file,const std::string& _input,const std::string& _output,const std::string& _weight="")
+    : DataFitObj(_file,_input,_output,_weight) { }
+
+protected:
+
+  virtual void model(const std::vector<double>& _params,unsigned long long _begin,unsigned long _n,double* _out) const {
+    // without an input column t is the row number
+    double rowt[CHUNK];
+    const double* t = input + _begin;
+    if(input == 0) {
+      for(unsigned long i=0;i<_n;i++) rowt[i] = (double) (_begin + i);
+      t = rowt;
+    }
+    int m = _params.size();
+    // Horner scheme, the loop over the rows is innermost
+    for(unsigned long i=0;i<_n;i++) _out[i] = m > 0 ? _params[m-1] : 0.0;
+    for(int k=m-2;k>=0;k--) {
+      double p = _params[k];
+      for(unsigned long i=0;i<_n;i++) _out[i] = _out[i] * t[i] + p;
+    }
+  }
+
+};
+
+#endif
@@ -0,0 +1,96 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _eoADObjFunc_h
+#define _eoADObjFunc_h
+
+#include <vector>
+#include <cmath>
+
+#include "eoObjFunc.h"
+#include "util/Dual.h"
+
+/**
+ * \file eoADObjFunc.h
+ * \class eoADObjFunc
+ *
+ * Base class of analytic objective functions written once for a generic
+ * scalar type. The subclass (Derived) implements
+ *
+ *   template<class Scalar>
+ *   bool function(const std::vector<Scalar>& _arg,double _cutoff,Scalar& _value) const
+ *
+ * which computes the value, may stop as soon as the value exceeds the
+ * cutoff (@see RSRRMVOF::evalBounded()) and must use unqualified calls of
+ * the elementary functions (e.g. "using std::cos; cos(x)"). The objective
+ * is evaluated with Scalar = double, the gradient by forward mode automatic
+ * differentiation with Scalar = Dual<N>, i.e. in ceil(n/N) passes, each
+ * propagating N tangent directions.
+ *
+ * @date: Oct. 2026
+ */
+template<class Derived,int N=4>
+class eoADObjFunc : public RSRRMVOF {
+
+public:
+
+  /// scalar type of the gradient passes
+  typedef Dual<N> ADScalar;
+
+  /**
+   * value and gradient by forward mode automatic differentiation, reentrant
+   *
+   * @param _arg    argument
+   * @param _grad   gradient
+   * @param _value  objective value
+   * @return number of passes, each costs a small multiple of an evaluation
+   */
+  virtual unsigned int gradient(const std::vector<double>& _arg,std::vector<double>& _grad,double& _value) {
+    unsigned n = _arg.size();
+    _grad.resize(n);
+    std::vector<ADScalar> x(n);
+    for(unsigned i=0;i<n;i++) x[i] = ADScalar(_arg[i]);
+    unsigned passes = 0;
+    for(unsigned j0=0;j0<n || passes==0;j0+=N) {
+      for(unsigned i=0;i<n;i++) x[i].seed((int) i - (int) j0);
+      ADScalar f;
+      static_cast<const Derived*>(this)->function(x,HUGE_VAL,f);
+      _value = f.value();
+      for(unsigned k=0;k<N && j0+k<n;k++) _grad[j0+k] = f.tangent(k);
+      passes++;
+    }
+    return passes;
+  }
+
+protected:
+
+  virtual double eval(const std::vector<double>& _arg) {
+    double value;
+    static_cast<const Derived*>(this)->function(_arg,HUGE_VAL,value);
+    return value;
+  }
+
+  virtual bool evalBounded(const std::vector<double>& _arg,double _cutoff,double& _value) {
+    return static_cast<const Derived*>(this)->function(_arg,_cutoff,_value);
+  }
+
+};
+
+#endif
@@ -35,6 +35,10 @@
 #include <eo>
 #include "es/eoReal.h"
 #include <vector>
+#include <string>
+#include <typeinfo>
+#include <cmath>
+#include <algorithm>
 
 /*
 Reminder: 
@@ -95,17 +99,109 @@ class RSRRMVOF : public eoObjFunc<EORVT,double,const std::vector<double>&> {
 public:
 
   virtual void operator()(EORVT& _eo) {
-    const std::vector<double>& v = (std::vector<double>)( _eo);
+    const std::vector<double>& v = _eo;
     _eo.fitness(this->eval(v));
   };
 
+  /** 
+   * bounded evaluation, may stop as soon as the value exceeds a cutoff 
+   * 
+   * @param _eo      argument 
+   * @param _cutoff  values above the cutoff are of no interest 
+   * @return false if the evaluation stopped early, the fitness is then 
+   *         a lower bound of the true value exceeding the cutoff 
+   */ 
+  virtual bool operator()(EORVT& _eo,double _cutoff) {
+    const std::vector<double>& v = _eo;
+    double value; 
+    bool exact = this->evalBounded(v,_cutoff,value);
+    _eo.fitness(value);
+    return exact;
+  }
+
   virtual void init() {
     INITIALIZED = true;
   }
 
+  /** 
+   * identity of the objective function, e.g. the key of its values in a 
+   * persistent cache (@see EvalCache). Objectives parameterized by a 
+   * formula or data include it, s.t. different problems get different keys. 
+   * 
+   * @return the class name by default 
+   */ 
+  virtual std::string identity() const {
+    return typeid(*this).name();
+  }
+
+  /** 
+   * number of residuals of a least squares objective f(x) = sum_i r_i(x)^2 
+   * 
+   * @param _dimension dimension of the argument 
+   * @return 0 if the objective does not provide residuals 
+   */ 
+  virtual unsigned long numResiduals(unsigned int _dimension) {
+    return 0;
+  }
+
+  /** 
+   * residual vector of a least squares objective, must be reentrant. 
+   * By default the single residual sqrt(f(x)) of a non-negative objective. 
+   * 
+   * @param _arg  argument 
+   * @param _r    residuals r_i(x), numResiduals() values 
+   */ 
+  virtual void residuals(const std::vector<double>& _arg,std::vector<double>& _r) {
+    _r.assign(1,std::sqrt(std::max(0.0,this->eval(_arg))));
+  }
+
+  /** 
+   * value and gradient of the objective, must be reentrant 
+   * 
+   * @param _arg    argument 
+   * @param _grad   gradient 
+   * @param _value  objective value 
+   * @return number of evaluation passes, 0 if the objective does not provide gradients 
+   *         (@see eoADObjFunc) 
+   */ 
+  virtual unsigned int gradient(const std::vector<double>& _arg,std::vector<double>& _grad,double& _value) {
+    return 0;
+  }
+
+  /** 
+   * incremental evaluation after a change of a few coordinates, must be 
+   * reentrant. To be overwritten by objectives whose terms depend on a few 
+   * coordinates. 
+   * 
+   * @param _arg       argument before the change 
+   * @param _value     objective value of _arg 
+   * @param _d         number of changed coordinates 
+   * @param _index     changed coordinates in ascending order 
+   * @param _delta     changes of the coordinates 
+   * @param _newValue  objective value of the changed argument 
+   * @return false if the objective does not provide incremental evaluation 
+   */ 
+  virtual bool evalIncremental(const std::vector<double>& _arg,double _value,unsigned _d,const unsigned* _index,const double* _delta,double& _newValue) {
+    return false;
+  }
+
 protected:
   //virtual double eval(const std::vector<double>& arg) = 0; 
 
+  /** 
+   * bounded evaluation to be overwritten by objectives which are sums of 
+   * non-negative terms, by default the objective is fully evaluated 
+   * 
+   * @param _arg     argument 
+   * @param _cutoff  values above the cutoff are of no interest 
+   * @param _value   objective value or partial sum exceeding the cutoff 
+   * @return whether _value is exact 
+   */ 
+  virtual bool evalBounded(const std::vector<double>& _arg,double _cutoff,double& _value) {
+    _value = this->eval(_arg);
+    return true;
+  }
+
 };
 
 #endif
@@ -0,0 +1,242 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _ExpressionObj_h
+#define _ExpressionObj_h
+
+#include <map>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <limits>
+
+#include "../eoObjFunc.h"
+#include "util/Expression.h"
+#include "util/Dual.h"
+
+/**
+ * \file ExpressionObj.h
+ * \class ExpressionObj
+ *
+ * Objective function given by a formula over x[i] at runtime, e.g. from the
+ * --formula flag of the basic menus (@see Expression for the syntax):
+ *
+ *   Rosenbrock : sum(i,0,n-2,100*(x[i+1]-x[i]^2)^2+(x[i]-1)^2)
+ *   Rastrigin  : 10*n+sum(i,0,n-1,x[i]^2-10*cos(2*pi*x[i]))
+ *   Griewank   : sum(i,0,n-1,x[i]^2)/4000-prod(i,0,n-1,cos(x[i]/sqrt(i+1)))+1
+ *
+ * The formula is parsed once and compiled into register bytecode for each
+ * dimension on first use. Single points are interpreted with a register file
+ * on the stack; gradients are computed by interpreting the bytecode with
+ * dual numbers (@see eoADObjFunc) and batches of points by the vectorized
+ * batch interpreter. The evaluation is reentrant.
+ *
+ * @date: Oct. 2026
+ */
+class ExpressionObj : public RSRRMVOF {
+
+public:
+
+  /// number of tangents per gradient pass
+  static const int TANGENTS = 4;
+
+  /// Cor. with the formula of configure()
+  ExpressionObj() : program(0) {
+    setFormula(defaultFormula());
+  }
+
+  /**
+   * Cor.
+   *
+   * @param _formula formula over x[i]
+   */
+  ExpressionObj(const std::string& _formula) : program(0) {
+    setFormula(_formula);
+  }
+
+  /// copy Cor., the formula is parsed again
+  ExpressionObj(const ExpressionObj& _other) : RSRRMVOF(_other),program(0) {
+    setFormula(_other.expression.formula());
+  }
+
+  /// Destructor
+  virtual ~ExpressionObj() {
+    clear();
+  }
+
+  /**
+   * set the formula of default constructed objectives
+   *
+   * @param _formula formula over x[i]
+   */
+  static void configure(const std::string& _formula) {
+    defaultFormula() = _formula;
+  }
+
+  /**
+   * parse a new formula, not while evaluating
+   *
+   * @param _formula formula over x[i]
+   * @return false on syntax errors
+   */
+  bool setFormula(const std::string& _formula) {
+    clear();
+    INITIALIZED = false;
+    if(_formula.empty()) {
+      std::cerr << "ExpressionObj: no formula, see ExpressionObj::configure()" << std::endl;
+      return false;
+    }
+    if(!expression.parse(_formula)) {
+      std::cerr << "ExpressionObj: " << expression.error() << std::endl;
+      return false;
+    }
+    INITIALIZED = true;
+    return true;
+  }
+
+  /// @return the formula
+  const std::string& getFormula() const {
+    return expression.formula();
+  }
+
+  /// @return the class name and the formula
+  virtual std::string identity() const {
+    return RSRRMVOF::identity() + ":" + expression.formula();
+  }
+
+  /**
+   * @param _dimension dimension
+   * @return the bytecode for the dimension, 0 if the formula does not compile
+   */
+  const ExpressionProgram* getProgram(unsigned int _dimension) {
+    const ExpressionProgram* p = program;
+    if(p != 0 && p->dimension() == _dimension) return p;
+    p = 0;
+#ifdef _OPENMP
+#pragma omp critical(ExpressionObj)
+#endif
+    {
+      std::map<unsigned int,ExpressionProgram*>::iterator it = programs.find(_dimension);
+      if(it != programs.end())
+	p = it->second;
+      else if(INITIALIZED) {
+	ExpressionProgram* q = new ExpressionProgram();
+	if(expression.compile(_dimension,*q))
+	  p = q;
+	else {
+	  std::cerr << "ExpressionObj: " << expression.error() << std::endl;
+	  delete q;
+	}
+	programs[_dimension] = (ExpressionProgram*) p;
+	// the first dimension is looked up without locking
+	if(program == 0 && p != 0) program = p;
+      }
+    }
+    return p;
+  }
+
+  /**
+   * evaluate a batch of points of the same dimension
+   *
+   * @param _x          pointers to the points
+   * @param _count      number of points
+   * @param _dimension  dimension of the points
+   * @param _out        objective values
+   */
+  void evalBatch(const double* const* _x,unsigned int _count,unsigned int _dimension,double* _out) {
+    const ExpressionProgram* p = getProgram(_dimension);
+    if(p == 0) {
+      for(unsigned k=0;k<_count;k++) _out[k] = std::numeric_limits<double>::quiet_NaN();
+      return;
+    }
+    std::vector<double> R(p->registers() * ExpressionProgram::BATCH);
+    p->run(_x,_count,_out,&R[0]);
+  }
+
+  /**
+   * value and gradient by interpreting the bytecode with dual numbers
+   *
+   * @return number of passes of TANGENTS directions
+   */
+  virtual unsigned int gradient(const std::vector<double>& _arg,std::vector<double>& _grad,double& _value) {
+    typedef Dual<TANGENTS> ADScalar;
+    unsigned n = _arg.size();
+    const ExpressionProgram* p = getProgram(n);
+    if(p == 0) return 0;
+    _grad.resize(n);
+    std::vector<ADScalar> x(n), W(std::max(1U,p->workspace()));
+    for(unsigned i=0;i<n;i++) x[i] = ADScalar(_arg[i]);
+    unsigned passes = 0;
+    for(unsigned j0=0;j0<n || passes==0;j0+=TANGENTS) {
+      for(unsigned i=0;i<n;i++) x[i].seed((int) i - (int) j0);
+      ADScalar f = p->run<ADScalar>(n > 0 ? &x[0] : 0,&W[0]);
+      _value = f.value();
+      for(unsigned k=0;k<(unsigned) TANGENTS && j0+k<n;k++) _grad[j0+k] = f.tangent(k);
+      passes++;
+    }
+    return passes;
+  }
+
+protected:
+
+  /** max. number of temporaries on the stack */
+  static const unsigned int STACKREGISTERS = 512;
+
+  /**
+   * the variables and the constants are read in place, only the temporaries
+   * are on the stack: their number does not grow with the dimension (an
+   * unrolled sum reuses them)
+   */
+  virtual double eval(const std::vector<double>& _arg) {
+    const ExpressionProgram* p = getProgram(_arg.size());
+    if(p == 0) return std::numeric_limits<double>::quiet_NaN();
+    const double* x = _arg.empty() ? 0 : &_arg[0];
+    if(p->temporaries() <= STACKREGISTERS) {
+      double T[STACKREGISTERS];
+      return p->evaluate(x,T);
+    }
+    // subexpressions nested deeper than STACKREGISTERS
+    std::vector<double> T(p->temporaries());
+    return p->evaluate(x,&T[0]);
+  }
+
+private:
+
+  static std::string& defaultFormula() {
+    static std::string formula;
+    return formula;
+  }
+
+  void clear() {
+    for(std::map<unsigned int,ExpressionProgram*>::iterator it=programs.begin();it!=programs.end();++it)
+      delete it->second;
+    programs.clear();
+    program = 0;
+  }
+
+  /// prevent copy assignment
+  ExpressionObj& operator=(const ExpressionObj&);
+
+  Expression                                  expression;  ///> parsed formula
+  std::map<unsigned int,ExpressionProgram*>   programs;    ///> bytecode per dimension (0: error)
+  const ExpressionProgram* volatile           program;     ///> bytecode of the first dimension
+};
+
+#endif
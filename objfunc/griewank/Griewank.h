@@ -21,29 +21,34 @@
 #ifndef _Griewank_h
 #define _Griewank_h
 
-#include "../eoObjFunc.h"
+#include "../eoADObjFunc.h"
 
 
 /**
  * \file Griewank.h
  * \class Griewank
- * Griewank benchmark function for real valued optimization
+ * Griewank benchmark function for real valued optimization, 
+ * with an automatically differentiated gradient 
  */ 
-class Griewank: public RSRRMVOF {
+class Griewank: public eoADObjFunc<Griewank> {
 
-protected:
-  virtual double eval(const std::vector<double>& _arg) {
-    double sum = 0; 
+public:
+
+  /// objective for a generic scalar type (@see eoADObjFunc), the cutoff is not used
+  template<class Scalar>
+  bool function(const std::vector<Scalar>& _arg,double _cutoff,Scalar& _sum) const {
+    using std::cos;
+    _sum = 0.0; 
     for (unsigned i = 0; i < _arg.size(); i++) {
-      sum += _arg[i] * _arg[i];
+      _sum += _arg[i] * _arg[i];
     }
-    sum /= 4000.0; 
-    double prod;
+    _sum /= 4000.0; 
+    Scalar prod = 1.0;
     for (unsigned i = 0; i < _arg.size(); i++) {
-      prod *= cos(_arg[i]/sqrt(i+1.0)); 
+      prod *= cos(_arg[i]/std::sqrt(i+1.0)); 
     }
-    sum = sum - prod + 1;
-    return sum;
+    _sum = _sum - prod + 1;
+    return true;
   } 
 
 };
@@ -21,24 +21,41 @@
 #ifndef _Rastrigin_h
 #define _Rastrigin_h
 
-#include "../eoObjFunc.h"
+#include "../eoADObjFunc.h"
 
 /**
  * \file Rastrigin.h
  * \class Rastrigin
  * 
- * Rastrigin benchmark function for real valued optimization
+ * Rastrigin benchmark function for real valued optimization, 
+ * with an automatically differentiated gradient 
  */ 
-class Rastrigin : public RSRRMVOF {
-
-protected:
-  virtual double eval(const std::vector<double>& _arg) {
-    double sum = 0.0; 
-    for(unsigned i=0;i<_arg.size();i++)
-      sum += _arg[i]*_arg[i] - 10 * cos(2 * M_PI * _arg[i]) + 10; 
-    return sum;
+class Rastrigin : public eoADObjFunc<Rastrigin> {
+
+public:
+
+  /// objective for a generic scalar type (@see eoADObjFunc)
+  template<class Scalar>
+  bool function(const std::vector<Scalar>& _arg,double _cutoff,Scalar& _sum) const {
+    using std::cos;
+    _sum = 0.0; 
+    for(unsigned i=0;i<_arg.size();i++) {
+      _sum += _arg[i]*_arg[i] - 10 * cos(2 * M_PI * _arg[i]) + 10; 
+      if(_sum > _cutoff) return false;
+    }
+    return true;
   } 
 
+  /// the terms depend on single coordinates 
+  virtual bool evalIncremental(const std::vector<double>& _arg,double _value,unsigned _d,const unsigned* _index,const double* _delta,double& _newValue) {
+    _newValue = _value;
+    for(unsigned k=0;k<_d;k++) {
+      double x = _arg[_index[k]], y = x + _delta[k];
+      _newValue += y*y - x*x - 10 * (std::cos(2 * M_PI * y) - std::cos(2 * M_PI * x));
+    }
+    return true;
+  }
+
 };
 
 #endif
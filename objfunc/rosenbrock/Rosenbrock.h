@@ -21,28 +21,76 @@
 #ifndef _Rosenbrock_h
 #define _Rosenbrock_h
 
-#include "../eoObjFunc.h"
+#include <algorithm>
+#include "../eoADObjFunc.h"
 
 
 /**
  * \file Rosenbrock.h
  * \class Rosenbrock
  * 
- * Rosenbrock benchmark function for real valued optimization
+ * Rosenbrock benchmark function for real valued optimization, 
+ * with residuals and an automatically differentiated gradient 
  */ 
-class Rosenbrock : public RSRRMVOF {
-
-protected:
-  virtual double eval(const std::vector<double>& _arg) {
-    double sum = 0.0; 
-    for(unsigned i=0;i<_arg.size()-1;i++) {
-      double t1 = _arg[i+1] - _arg[i] * _arg[i]; 
-      double t2 = _arg[i] - 1; 
-      sum += 100 * t1*t1 + t2*t2; 
+class Rosenbrock : public eoADObjFunc<Rosenbrock> {
+
+public:
+
+  virtual unsigned long numResiduals(unsigned int _dimension) {
+    return _dimension < 2 ? 0 : 2 * (_dimension - 1);
+  }
+
+  virtual void residuals(const std::vector<double>& _arg,std::vector<double>& _r) {
+    _r.resize(numResiduals(_arg.size()));
+    for(unsigned i=0;i+1<_arg.size();i++) {
+      _r[2*i]   = 10 * (_arg[i+1] - _arg[i] * _arg[i]);
+      _r[2*i+1] = _arg[i] - 1;
+    }
+  }
+
+  /// objective for a generic scalar type (@see eoADObjFunc)
+  template<class Scalar>
+  bool function(const std::vector<Scalar>& _arg,double _cutoff,Scalar& _sum) const {
+    _sum = 0.0; 
+    for(unsigned i=0;i+1<_arg.size();i++) {
+      Scalar t1 = _arg[i+1] - _arg[i] * _arg[i]; 
+      Scalar t2 = _arg[i] - 1.0; 
+      _sum += 100 * t1*t1 + t2*t2; 
+      if(_sum > _cutoff) return false;
     }
-    return sum;
+    return true;
   } 
 
+  /// the term i depends on the coordinates i and i+1 
+  virtual bool evalIncremental(const std::vector<double>& _arg,double _value,unsigned _d,const unsigned* _index,const double* _delta,double& _newValue) {
+    _newValue = _value;
+    long last = -1;  // last updated term 
+    for(unsigned k=0;k<_d;k++) {
+      for(long i=(long) _index[k]-1;i<=(long) _index[k];i++) {
+	if(i <= last || i < 0 || i + 1 >= (long) _arg.size()) continue;
+	double x0 = _arg[i], x1 = _arg[i+1];
+	double y0 = x0 + changeOf(i,_d,_index,_delta), y1 = x1 + changeOf(i+1,_d,_index,_delta);
+	_newValue += term(y0,y1) - term(x0,x1);
+	last = i;
+      }
+    }
+    return true;
+  }
+
+private:
+
+  /// term of the coordinates i, i+1 
+  static double term(double _x0,double _x1) {
+    double t1 = _x1 - _x0 * _x0, t2 = _x0 - 1.0;
+    return 100 * t1*t1 + t2*t2;
+  }
+
+  /// change of the coordinate _i 
+  static double changeOf(long _i,unsigned _d,const unsigned* _index,const double* _delta) {
+    const unsigned* p = std::lower_bound(_index,_index + _d,(unsigned) _i);
+    return p != _index + _d && *p == (unsigned) _i ? _delta[p - _index] : 0.0;
+  }
+
 };
 
 #endif
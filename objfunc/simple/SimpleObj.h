@@ -30,14 +30,42 @@
  */ 
 class SimpleObj: public RSRRMVOF {
 
+public:
+
+  virtual unsigned long numResiduals(unsigned int _dimension) {
+    return _dimension;
+  }
+
+  virtual void residuals(const std::vector<double>& _arg,std::vector<double>& _r) {
+    _r.resize(_arg.size());
+    for (unsigned i = 0; i < _arg.size(); i++) 
+      _r[i] = std::sqrt(2.0) * _arg[i];
+  }
+
+  virtual bool evalIncremental(const std::vector<double>& _arg,double _value,unsigned _d,const unsigned* _index,const double* _delta,double& _newValue) {
+    _newValue = _value;
+    for(unsigned k=0;k<_d;k++) {
+      double x = _arg[_index[k]];
+      _newValue += 2 * _delta[k] * (2 * x + _delta[k]);
+    }
+    return true;
+  }
+
 protected:
 
   virtual double eval(const std::vector<double>& _arg) {
-    double sum = 0; 
+    double sum; 
+    evalBounded(_arg,HUGE_VAL,sum);
+    return sum;
+  } 
+
+  virtual bool evalBounded(const std::vector<double>& _arg,double _cutoff,double& _sum) {
+    _sum = 0; 
     for (unsigned i = 0; i < _arg.size(); i++) {
-      sum += 2 * _arg[i] * _arg[i];
+      _sum += 2 * _arg[i] * _arg[i];
+      if(_sum > _cutoff) return false;
     }
-    return sum;
+    return true;
   } 
 
 };
@@ -51,6 +51,9 @@ using namespace std;
 // include for solution initialization
 #include "util/Utilities.h"
 
+// objective function given by the --formula flag
+#include "objfunc/expression/ExpressionObj.h"
+
 #include "PopulationSearchManager.h"
 
 template<class eoObjFunc> 
@@ -138,6 +141,8 @@ template<class eoObjFunc>
     const char* FUNCMENU = "Goal Function";
     const char* SCMENU   = "Stopping Criteria";
     const char* EAMENU   = "Evolutionary Algorithm";
+    const char* MEMMENU  = "Memetic";
+    const char* SURMENU  = "Surrogate";
 
      // execute the local search
     bool execute  = processFlag<bool>(false,"execute","Execute the local search");
@@ -148,6 +153,14 @@ template<class eoObjFunc>
     // problem size
     unsigned N = processFlag<unsigned>(unsigned(10),"vecSize","The number of variables ",false,FUNCMENU);
 
+    // formula of ExpressionObj, set before the objective function is constructed 
+    string formula = processFlag<string>(string(""),"formula","objective function over x[i] and n, e.g. sum(i,0,n-1,x[i]^2) (ExpressionObj)",false,FUNCMENU);
+    if(!formula.empty()) {
+      if(typeid(eoObjFunc) != typeid(ExpressionObj)) 
+	std::cerr << "formula : only used by ExpressionObj\n";
+      ExpressionObj::configure(formula);
+    }
+
     unsigned popSize = processFlag<unsigned>(20,"popSize","Population size",false,EAMENU);
 
      // boundaries box 
@@ -167,6 +180,14 @@ template<class eoObjFunc>
     string str_status = _filename + ".status"; 
     string statusParam = processFlag<string>(str_status,"status","Status file",false,"Persistence");
 
+    string checkpointFile = processFlag<string>(string(""),"checkpoint","Binary checkpoint file (empty: none)",false,"Persistence");
+    unsigned checkpointEvery = processFlag<unsigned>(10,"checkpointEvery","checkpoint each checkpointEvery generations",false,"Persistence");
+    string resumeFile = processFlag<string>(string(""),"resume","Resume the run from a checkpoint file, e.g. the one of --checkpoint (empty: none)",false,"Persistence");
+    string archiveFile = processFlag<string>(string(""),"archive","Memory mapped archive of all evaluated points (empty: none)",false,"Persistence");
+    string cacheFile = processFlag<string>(string(""),"cache","Persistent cache of objective values shared by runs (empty: none)",false,"Persistence");
+    unsigned cacheSize = processFlag<unsigned>(1048576,"cacheSize","max. number of points in a new cache",false,"Persistence");
+    string cacheKey = processFlag<string>(string(""),"cacheKey","identity of the objective function in the cache (empty: class name, formula or dataset)",false,"Persistence");
+
     eoRealVectorBounds& temp = boundsParam.value();
     eoRealVectorBounds bounds;
     bounds.resize(temp.size());
@@ -176,8 +197,25 @@ template<class eoObjFunc>
     vector<double> lowBounds,uppBounds; 
     Utilities::getBounds(bounds,lowBounds,uppBounds);
 
-    manager = new PopulationSearchManagerEA<eoObjFunc>(lowBounds,uppBounds,
-						       popSize,maxGen,seed,pCross,pMut);
+    Checkpoint cp;
+    if(!resumeFile.empty() && cp.load(resumeFile) && cp.kind == Checkpoint::POPULATION && cp.size() > 0) {
+      // the restored population is not evaluated again
+      eoPop<EORVT> restored;
+      for(unsigned i=0;i<cp.size();i++) {
+	EORVT v;
+	cp.getSolution(i,v);
+	restored.push_back(v);
+      }
+      manager = new PopulationSearchManagerEA<eoObjFunc>(restored,maxGen,pCross,pMut);
+      manager->resume(resumeFile);
+    } else {
+      if(!resumeFile.empty()) std::cerr << "resume : no valid checkpoint " << resumeFile << std::endl;
+      manager = new PopulationSearchManagerEA<eoObjFunc>(lowBounds,uppBounds,
+							 popSize,maxGen,seed,pCross,pMut);
+    }
+    if(!checkpointFile.empty()) manager->setCheckpoint(checkpointFile,checkpointEvery);
+    if(!archiveFile.empty()) manager->setArchive(archiveFile);
+    if(!cacheFile.empty()) manager->setCache(cacheFile,cacheSize,cacheKey);
     
     uint32_t maxeval = processFlag<uint32_t>(10000,"maxeval","max. number of function's evaluations",false,SCMENU);  
     manager->setMaxFuncEval(maxeval);
@@ -264,6 +302,40 @@ template<class eoObjFunc>
       } else 
 	std::cerr << "Replacement : Comma, Plus, EPTour, SSGAWorst, SSGADet\n";
     }
+
+    {
+      unsigned numElites = processFlag<unsigned>(0,"memeticElites","Num. of best individuals refined by a local search (0: off)",false,MEMMENU);
+      if(numElites > 0) {
+	unsigned every = processFlag<unsigned>(1,"memeticEvery","Refinement each memeticEvery generations",false,MEMMENU);
+	unsigned budget = processFlag<unsigned>(100,"memeticBudget","max. number of function's evaluations of a refinement",false,MEMMENU);
+	unsigned numNeighbors = processFlag<unsigned>(20,"memeticNeighbors","Num. of neighbors of the local search",false,MEMMENU);
+	double radius = processFlag<double>(0.1,"memeticRadius","The radius of the neighborhood of the local search",false,MEMMENU);
+	string localSearch = processFlag<string>(string("SimpleHC"),"memeticLS","Local search: SimpleHC, FirstImprHC or QuasiNewton",false,MEMMENU);
+	if(!localSearch.compare("SimpleHC")) {
+	  manager->template setMemetic<SimpleHillClimbing>(numElites,every,budget,numNeighbors,radius);
+	} else if(!localSearch.compare("FirstImprHC")) {
+	  manager->template setMemetic<FirstImprHillClimbing>(numElites,every,budget,numNeighbors,radius);
+	} else if(!localSearch.compare("QuasiNewton")) {
+	  manager->template setMemetic<QuasiNewton>(numElites,every,budget,numNeighbors,radius);
+	} else 
+	  std::cerr << "memeticLS : SimpleHC, FirstImprHC or QuasiNewton\n";
+      }
+    }
+
+    {
+      string surrogate = processFlag<string>(string("None"),"surrogate","Pre-selection of offspring: None, RBF or Quadratic",false,SURMENU);
+      if(surrogate.compare("None")) {
+	double fraction = processFlag<double>(0.25,"surrogateFraction","fraction of the generated offspring which is evaluated",false,SURMENU);
+	if(!surrogate.compare("RBF")) {
+	  unsigned window = processFlag<unsigned>(200,"surrogateWindow","num. of recent points of the RBF model",false,SURMENU);
+	  manager->setSurrogate(new moRBFSurrogate(window),fraction);
+	} else if(!surrogate.compare("Quadratic")) {
+	  double forgetting = processFlag<double>(0.99,"surrogateForgetting","forgetting factor of the quadratic model",false,SURMENU);
+	  manager->setSurrogate(new moQuadraticSurrogate(forgetting),fraction);
+	} else 
+	  std::cerr << "surrogate : None, RBF or Quadratic\n";
+      }
+    }
      
     
     if (parser.userNeedsHelp()) {
@@ -42,6 +42,13 @@
 
 #include "remo/moRealTypes.h"
 #include "util/Utilities.h"
+#include "util/GenomePool.h"
+#include "eoMemeticReplacement.h"
+#include "eoSurrogateTransform.h"
+#include "eoPooledSelectPerc.h"
+#include "eoPooledReplacement.h"
+#include "eoCheckpointSaver.h"
+#include "eoArchiveStep.h"
 
 using namespace std;
 
@@ -71,7 +78,8 @@ class BasePopulationSearchManager {
 			      unsigned int _POP_SIZE=20,
 			      unsigned int _MAX_GEN=500,
 			      unsigned int _SEED=time(0)) 
-    : POP_SIZE(_POP_SIZE),MAX_GEN(_MAX_GEN),INITIALIZED(false),eval(evalFunc) { 
+    : POP_SIZE(_POP_SIZE),MAX_GEN(_MAX_GEN),INITIALIZED(false),cacheEval(evalFunc),archiveEval(cacheEval),eval(archiveEval),
+    checkpoint(0),resumedGenerations(0) { 
     rng.reseed(_SEED);
     initPopulation(_lowerBound,_upperBound);
   }
@@ -85,11 +93,13 @@ class BasePopulationSearchManager {
    */
  BasePopulationSearchManager(eoPop<EORVT> _pop,
 			     unsigned int _MAX_GEN=500) 
-   : POP_SIZE(_pop.size()),MAX_GEN(_MAX_GEN),pop(_pop),INITIALIZED(false),eval(evalFunc) {  }
+   : POP_SIZE(_pop.size()),MAX_GEN(_MAX_GEN),pop(_pop),INITIALIZED(false),cacheEval(evalFunc),archiveEval(cacheEval),eval(archiveEval),
+    checkpoint(0),resumedGenerations(0) {  }
 
   /// Destructor 
   virtual ~BasePopulationSearchManager() {
     try {
+      delete checkpoint;
     }
     catch (int e) {
       std::cerr << "exception at Destructor of BasePopulationSearchManager : Nr. " << e << std::endl;
@@ -118,6 +128,73 @@ class BasePopulationSearchManager {
     rng.reseed(_seed);
   }
 
+  /**
+   * write a binary checkpoint each _every generations and at the end of the run 
+   * 
+   * @param _file   checkpoint file 
+   * @param _every  checkpoint frequency in generations 
+   */
+  void setCheckpoint(const std::string& _file,unsigned int _every=10) {
+    if(INITIALIZED) std::cerr << "setCheckpoint::object already initialized\n";
+    delete checkpoint;
+    checkpoint = new eoCheckpointSaver<EORVT>(eval,_file,_every);
+  }
+
+  /**
+   * append all points evaluated by the algorithm to a memory mapped archive 
+   * (@see EvalArchive), an existing archive is continued. The initial 
+   * population is evaluated at construction and hence not archived. 
+   * 
+   * @param _file  archive file 
+   * @return false if the archive cannot be opened 
+   */
+  virtual bool setArchive(const std::string& _file) {
+    if(INITIALIZED) std::cerr << "setArchive::object already initialized\n";
+    return archiveEval.open(_file,pop.empty() ? 0 : pop[0].size());
+  }
+
+  /**
+   * consult a persistent cache of objective values (@see EvalCache) shared 
+   * among runs and processes, new objective values are added to the cache. 
+   * The initial population is evaluated at construction without the cache. 
+   * 
+   * @param _file      cache file 
+   * @param _capacity  max. number of cached points of a new cache 
+   * @param _identity  identity of the objective function (empty: RSRRMVOF::identity()) 
+   * @return false if the cache cannot be opened 
+   */
+  virtual bool setCache(const std::string& _file,unsigned long long _capacity=1048576,const std::string& _identity="") {
+    if(INITIALIZED) std::cerr << "setCache::object already initialized\n";
+    return cacheEval.open(_file,pop.empty() ? 0 : pop[0].size(),_capacity,
+			  _identity.empty() ? evalFunc.identity() : _identity);
+  }
+
+  /**
+   * resume a run from a checkpoint: the population, the evaluation and 
+   * generation counters and the random number generator are restored. 
+   * Call before init(). 
+   * 
+   * @param _file  checkpoint file 
+   * @return false if there is no valid population checkpoint 
+   */
+  virtual bool resume(const std::string& _file) {
+    if(INITIALIZED) std::cerr << "resume::object already initialized\n";
+    Checkpoint cp;
+    if(!cp.load(_file) || cp.kind != Checkpoint::POPULATION || cp.size() == 0) {
+      std::cerr << "resume(): no valid checkpoint " << _file << std::endl;
+      return false;
+    }
+    pop.resize(cp.size());
+    for(unsigned int i=0;i<cp.size();i++)
+      cp.getSolution(i,pop[i]);
+    POP_SIZE = pop.size();
+    eval.value() = cp.evaluations;
+    cp.getRng(rng);
+    resumedGenerations = cp.steps;
+    if(checkpoint != 0) checkpoint->setGenerations(resumedGenerations);
+    return true;
+  }
+
   /**
    * execution
    */ 
@@ -129,6 +206,11 @@ class BasePopulationSearchManager {
     _os << "\n ============================================================ \n";
     pop.printOn(_os);
     _os << "\n obj func cntr : " << eval.value() << std::endl;
+    if(cacheEval.getNumHits() > 0) 
+      _os << " evaluations taken from the cache : " << cacheEval.getNumHits() << std::endl;
+    if(genomes.getNumAcquired() > 0) 
+      _os << " recycled genomes : " << genomes.getNumRecycled() << " of " << genomes.getNumAcquired() 
+	  << " (high-water mark " << genomes.getHighWaterMark() << " bytes)" << std::endl;
    }
 
  protected:
@@ -137,10 +219,15 @@ class BasePopulationSearchManager {
   
   eoPop<EORVT> pop;         ///> population 
   eoObjFunc    evalFunc;        ///> objective function
-  eoEvalFuncCounter<EORVT> eval;
+  CacheEval    cacheEval;       ///> objective function consulting the cache
+  ArchiveEval  archiveEval;     ///> objective function appending to the archive
+  GoalFuncCounter eval;         ///> thread-safe counter of function evaluations
   unsigned int POP_SIZE;    ///> Size of population
   unsigned int MAX_GEN;     ///> Maximum number of generation before STOP
   bool         INITIALIZED; ///> whether object is initialized        
+  eoCheckpointSaver<EORVT>* checkpoint;  ///> periodic checkpoint (0: none)
+  unsigned long resumedGenerations;      ///> number of generations before the resume
+  GenomePool   genomes;         ///> genome buffers recycled from generation to generation
 
  private:
 
@@ -195,7 +282,8 @@ template<class eoObjFunc>
 			    float _MUT_RATE = 0.5) 
     : BasePopulationSearchManager<eoObjFunc>(_lowerBound,_upperBound,
 					     _POP_SIZE,_MAX_GEN,_SEED),
-    CROSS_RATE(_CROSS_RATE),MUT_RATE(_MUT_RATE),genCont(_MAX_GEN),continuator(genCont),maxEval(0)
+    CROSS_RATE(_CROSS_RATE),MUT_RATE(_MUT_RATE),genCont(_MAX_GEN),continuator(genCont),steadyCont(0),maxEval(0),MAX_EVAL(0),
+    archiveStep(this->archiveEval)
     // checkpoint(0),counter(0),increment(counter),monitor(false) 
     {  }
   
@@ -213,7 +301,8 @@ template<class eoObjFunc>
 			   float _CROSS_RATE=0.8,
 			   float _MUT_RATE = 0.5) 
    : BasePopulationSearchManager<eoObjFunc>(_pop,_MAX_GEN),
-    CROSS_RATE(_CROSS_RATE),MUT_RATE(_MUT_RATE),genCont(_MAX_GEN),continuator(genCont),maxEval(0)
+    CROSS_RATE(_CROSS_RATE),MUT_RATE(_MUT_RATE),genCont(_MAX_GEN),continuator(genCont),steadyCont(0),maxEval(0),MAX_EVAL(0),
+    archiveStep(this->archiveEval)
     // checkpoint(0),counter(0),increment(counter),monitor(false) 
   {  }
 
@@ -251,6 +340,7 @@ template<class eoObjFunc>
   void setMaxFuncEval(unsigned int _maxeval) {
     if(this->INITIALIZED) std::cerr << "setMaxFuncEval::object already initialized\n";
     maxEval = new eoEvalContinue<EORVT>(this->eval,_maxeval);
+    MAX_EVAL = _maxeval;
     continuator.add(*maxEval);
   }
 
@@ -259,6 +349,17 @@ template<class eoObjFunc>
    */ 
   virtual void init() { 
     if(this->INITIALIZED) return;
+    if(this->checkpoint != 0) {
+      this->checkpoint->setGenerations(this->resumedGenerations);
+      continuator.add(*this->checkpoint);
+    }
+    // the generations are counted in total after a resume 
+    if(this->resumedGenerations > 0) 
+      genCont.totalGenerations(this->MAX_GEN > this->resumedGenerations ? this->MAX_GEN - this->resumedGenerations : 0);
+    if(this->archiveEval.getArchive() != 0) {
+      archiveStep.setGenerations(this->resumedGenerations);
+      continuator.add(archiveStep);
+    }
     BasePopulationSearchManager<eoObjFunc>::init();
     /*checkpoint = new eoCheckPoint<EORVT>(continuator);
     checkpoint->add(increment);
@@ -278,6 +379,8 @@ template<class eoObjFunc>
   eoCombinedContinue<EORVT> continuator;  ///> stopping criteria 
   eoSteadyFitContinue<EORVT>* steadyCont; ///> stopping criteria
   eoEvalContinue<EORVT>* maxEval;         ///> Stopping criteria max. function evaluations
+  unsigned int MAX_EVAL;                  ///> max. num. of function evaluations (0: unbounded)
+  eoArchiveStep<EORVT> archiveStep;       ///> generation counter of the archive 
   
   /*eoCheckPoint<EORVT>* checkpoint;
   unsigned int counter;
@@ -403,6 +506,7 @@ template<class eoObjFunc>
    */ 
   virtual void run() { 
     (*sga)(this->pop);
+    if(this->checkpoint != 0) this->checkpoint->save(this->pop,true);
     this->pop.sort();
     //cout << "final population \n" << this->pop << endl;
   }
@@ -620,7 +724,8 @@ template<class eoObjFunc>
     : PopulationSearchManagerSGA<eoObjFunc>(_lowerBound,_upperBound,
 					   _POP_SIZE,_MAX_GEN,_SEED,
 					   _CROSS_RATE,_MUT_RATE),
-    transform(0),select(0),replace(0),ea(0),offspringrate(1.0)
+    transform(0),select(0),replace(0),memetic(0),pooled(0),surrogateEval(this->eval),surrogate(0),screen(0),
+    fraction(1.0),ea(0),offspringrate(1.0)
      {  }
   
   /**
@@ -637,7 +742,8 @@ template<class eoObjFunc>
 			   float _CROSS_RATE=0.8,
 			   float _MUT_RATE = 0.5) 
    : PopulationSearchManagerSGA<eoObjFunc>(_pop,_MAX_GEN,_CROSS_RATE,_MUT_RATE),
-    transform(0),select(0),replace(0),ea(0),offspringrate(1.0) {}
+    transform(0),select(0),replace(0),memetic(0),pooled(0),surrogateEval(this->eval),surrogate(0),screen(0),
+    fraction(1.0),ea(0),offspringrate(1.0) {}
 
 
   /// Destructor 
@@ -645,6 +751,10 @@ template<class eoObjFunc>
     try {
       delete select;
       delete replace;
+      delete memetic;
+      delete pooled;
+      delete screen;
+      delete surrogate;
       delete transform;
       delete ea;
     }
@@ -659,10 +769,18 @@ template<class eoObjFunc>
    */
   virtual void run() {
     (*ea)(this->pop);
+    if(this->checkpoint != 0) this->checkpoint->save(this->pop,true);
     this->pop.sort();
     //cout << "final population \n" << this->pop << endl;
   }
 
+  /// print 
+  virtual void printOn(std::ostream& _os=std::cout) const {
+    PopulationSearchManagerSGA<eoObjFunc>::printOn(_os);
+    if(screen != 0) 
+      _os << " offspring rejected by " << surrogate->className() << " : " << screen->getNumRejected() << std::endl;
+  }
+
 
   /**
    * Initialization 
@@ -756,6 +874,46 @@ template<class eoObjFunc>
     replace = new eoDeterministicSaDReplacement<EORVT>(_surviveP,_dieP,_surviveP,_dieP,true);
   }
 
+  /**
+   * memetic mode: the best individuals of each _every-th generation are refined
+   * by a short local search of moRealTypes.h, e.g. setMemetic<SimpleHillClimbing>(...).
+   * The refinements run concurrently, use the evaluation counter of the manager 
+   * and respect the limit of setMaxFuncEval().
+   *
+   * @param _numElites     number of refined individuals 
+   * @param _every         refinement each _every generations
+   * @param _budget        max. num. of function evaluations of a single refinement
+   * @param _numNeighbors  number of neighbors of the local search
+   * @param _radius        neighborhood boundary radius of the local search
+   * @param _parallel      whether the refinements run concurrently 
+   */ 
+  template<class LocalSearch>
+  void setMemetic(unsigned int _numElites,unsigned int _every=1,unsigned int _budget=100,
+		  unsigned int _numNeighbors=20,double _radius=0.1,bool _parallel=true) {
+    if(this->INITIALIZED)
+      std::cerr << "setMemetic() : instance already initialized\n";
+    delete memetic;
+    memetic = new eoMemeticReplacement<LocalSearch>(this->eval,_numElites,_every,_budget,
+						    _numNeighbors,_radius,_parallel);
+  }
+
+  /**
+   * surrogate-assisted pre-selection: 1/_fraction times more offspring are 
+   * generated, ranked by a surrogate model trained on all evaluations and 
+   * only the most promising ones are evaluated. The manager takes the 
+   * ownership of the model.
+   *
+   * @param _surrogate  e.g. new moRBFSurrogate() or new moQuadraticSurrogate()
+   * @param _fraction   fraction of the generated offspring which is evaluated ]0,1]
+   */ 
+  void setSurrogate(moSurrogate* _surrogate,double _fraction=0.25) {
+    if(this->INITIALIZED)
+      std::cerr << "setSurrogate() : instance already initialized\n";
+    delete surrogate;
+    surrogate = _surrogate;
+    fraction = _fraction > 0.0 && _fraction <= 1.0 ? _fraction : 1.0;
+  }
+
 
   
 
@@ -766,16 +924,41 @@ template<class eoObjFunc>
    */ 
   virtual void initPS() { 
     PopulationSearchManagerSGA<eoObjFunc>::initPS();
-    select = new eoSelectPerc<EORVT>(*(this->selectOne),offspringrate);
     if(replace == 0)
       replace = new eoGenerationalReplacement<EORVT>();
     transform = new eoSGATransform<EORVT>(*(this->xover),this->CROSS_RATE,*(this->mutation),this->MUT_RATE);
-    ea = new eoEasyEA<EORVT>(this->continuator,this->eval,*select,*transform,*replace);
+    eoTransform<EORVT>* variation = transform;
+    if(surrogate != 0) {
+      for(unsigned int i=0;i<this->pop.size();i++)
+	if(!this->pop[i].invalid()) surrogate->add(this->pop[i],(double) this->pop[i].fitness());
+      surrogateEval.setModel(surrogate);
+      // the same number of offspring as eoSelectPerc without pre-selection
+      unsigned int numOffspring = (unsigned int) std::floor(offspringrate * this->pop.size());
+      screen = new eoSurrogateTransform(*transform,*surrogate,numOffspring,&this->genomes);
+      variation = screen;
+      select = new eoPooledSelectPerc(*(this->selectOne),this->genomes,offspringrate / fraction);
+    } else 
+      select = new eoPooledSelectPerc(*(this->selectOne),this->genomes,offspringrate);
+    eoReplacement<EORVT>* replacement = replace;
+    if(memetic != 0) {
+      memetic->setReplacement(*replace);
+      if(this->MAX_EVAL > 0) memetic->setEvalLimit(this->eval,this->MAX_EVAL);
+      replacement = memetic;
+    } 
+    // the discarded individuals of a generation give their genomes to the offspring of the next one
+    pooled = new eoPooledReplacement(*replacement,this->genomes);
+    ea = new eoEasyEA<EORVT>(this->continuator,surrogateEval,*select,*variation,*pooled);
   }
 
   eoSGATransform<EORVT>*              transform; ///>
-  eoSelectPerc<EORVT>*                select;    ///> Selection Criteria
+  eoPooledSelectPerc*                 select;    ///> Selection Criteria
   eoReplacement<EORVT>*   replace;   ///> Generational replacement
+  eoMemeticReplacementBase*  memetic; ///> local refinement of elites (memetic mode)
+  eoPooledReplacement*    pooled;    ///> replacement recycling the discarded genomes
+  SurrogateEval           surrogateEval; ///> counted evaluation training the surrogate model
+  moSurrogate*            surrogate; ///> surrogate model for the pre-selection (0: none)
+  eoSurrogateTransform*   screen;    ///> variation with surrogate-assisted pre-selection
+  double                  fraction;  ///> fraction of evaluated offspring 
 
   double offspringrate;  ///> growing rate of offsprings w.r.t. population
  private: 
@@ -0,0 +1,513 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+/**
+ * \file  PopulationSearchManagerBO.h
+ *
+ * @date: Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+
+#ifndef _PopulationSearchManagerBO_h
+#define _PopulationSearchManagerBO_h
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "PopulationSearchManager.h"
+#include "util/LinearAlgebra.h"
+#include "util/ParallelEval.h"
+
+using namespace std;
+
+
+/**
+ * \class PopulationSearchManagerBO
+ *
+ * Bayesian optimization with a Gaussian process surrogate for very expensive
+ * objective functions, the population is the initial design within bounds
+ *
+ * - the GP uses an isotropic Matern 5/2 kernel on the box scaled to [0,1]^n,
+ *   a constant mean and a profiled signal variance
+ * - new points are appended to the packed Cholesky factor in O(m^2), the
+ *   length scale is re-estimated by maximum likelihood (grid search on the
+ *   worker pool) and the factor rebuilt each refit points only
+ * - the expected improvement is maximized by pattern searches started
+ *   concurrently from the best point and the most promising random points
+ * - a batch of q points is selected by the kriging believer heuristic, i.e.
+ *   each selected point enters the GP with its predicted value, and the q
+ *   points are evaluated concurrently (@see ParallelEval). The factor only
+ *   depends on the points, hence it remains valid when the predicted values
+ *   are replaced by the objective values.
+ *
+ * All evaluations, including the initial design, are counted, s.t. the
+ * limit of setMaxFuncEval() is not exceeded.
+ */
+template<class eoObjFunc>
+class PopulationSearchManagerBO : public BasePopulationSearchManager<eoObjFunc> {
+
+ public:
+
+  /**
+   * Basic constructor
+   *
+   * @param _lowerBound lower bound of the search space
+   * @param _upperBound upper bound of the search space
+   * @param _POP_SIZE   size of the random initial design (0: 2n+1)
+   * @param _MAX_GEN    maximum number of batches
+   * @param _SEED       random seed
+   */
+  PopulationSearchManagerBO(const vector<double>& _lowerBound,
+			    const vector<double>& _upperBound,
+			    unsigned int _POP_SIZE=0,
+			    unsigned int _MAX_GEN=100000,
+			    unsigned int _SEED=time(0))
+    : BasePopulationSearchManager<eoObjFunc>(_lowerBound,_upperBound,
+					     _POP_SIZE > 0 ? _POP_SIZE : 2*_lowerBound.size()+1,_MAX_GEN,_SEED),
+    lowerBound(_lowerBound),upperBound(_upperBound),maxEval(0),batchSize(1),numStarts(10),
+    refitEvery(10),fixedLength(0.0),length(0.2),nugget(1e-6),m(0),ymean(0.0),sigma2(1.0),
+    sinceRefit(0),gen(0) { }
+
+  /// Destructor
+  virtual ~PopulationSearchManagerBO() { }
+
+  /**
+   * append all evaluated points to a memory mapped archive
+   *
+   * @param _file  archive file
+   * @return false if the archive cannot be opened
+   */
+  virtual bool setArchive(const std::string& _file) {
+    return this->archiveEval.open(_file,lowerBound.size());
+  }
+
+  /**
+   * consult a persistent cache of objective values
+   *
+   * @param _file      cache file
+   * @param _capacity  max. number of cached points of a new cache
+   * @param _identity  identity of the objective function (empty: RSRRMVOF::identity())
+   * @return false if the cache cannot be opened
+   */
+  virtual bool setCache(const std::string& _file,unsigned long long _capacity=1048576,const std::string& _identity="") {
+    return this->cacheEval.open(_file,lowerBound.size(),_capacity,
+				_identity.empty() ? this->evalFunc.identity() : _identity);
+  }
+
+  /**
+   * set stopping criteria max num. of function evaluation (including the
+   * initial design), the last batch is shortened s.t. it is not exceeded
+   *
+   * @param _maxeval max. num. of function evaluation
+   */
+  void setMaxFuncEval(unsigned int _maxeval) {
+    maxEval = _maxeval;
+  }
+
+  /**
+   * set the number of points selected and evaluated concurrently per batch
+   *
+   * @param _batchSize batch size q
+   */
+  void setBatchSize(unsigned int _batchSize) {
+    batchSize = std::max(1u,_batchSize);
+  }
+
+  /**
+   * set the number of concurrent starts of the acquisition optimization
+   *
+   * @param _numStarts number of starts
+   */
+  void setNumStarts(unsigned int _numStarts) {
+    numStarts = std::max(1u,_numStarts);
+  }
+
+  /**
+   * set the kernel hyper parameters
+   *
+   * @param _length      length scale relative to the box (0: maximum likelihood)
+   * @param _refitEvery  number of new points between the estimations of the length scale
+   * @param _nugget      regularization of the kernel matrix
+   */
+  void setKernel(double _length,unsigned int _refitEvery=10,double _nugget=1e-6) {
+    fixedLength = _length;
+    refitEvery = std::max(1u,_refitEvery);
+    nugget = _nugget;
+  }
+
+  /**
+   * execution
+   */
+  virtual void run() {
+    if(!this->INITIALIZED) {
+      std::cerr << "initialization should be done by calling PopulationSearchManagerBO::init()" << std::endl;
+      return;
+    }
+    while(gen < this->MAX_GEN) {
+      unsigned q = batchSize;
+      if(maxEval > 0) {
+	if(this->eval.value() >= maxEval) break;
+	q = std::min<unsigned long>(q,maxEval - this->eval.value());
+      }
+      batch(q);
+    }
+    // the best points found
+    std::vector<unsigned> ranking(m);
+    for(unsigned i=0;i<m;i++) ranking[i] = i;
+    std::sort(ranking.begin(),ranking.end(),RankCompare(Y));
+    unsigned size = std::min<unsigned>(this->POP_SIZE,m);
+    this->pop.resize(size);
+    for(unsigned k=0;k<size;k++) {
+      EORVT& x = this->pop[k];
+      fromUnit(&X[ranking[k]*n],x);
+      x.fitness(Y[ranking[k]]);
+    }
+    if(this->pop.empty() || best.fitness() > this->pop.best_element().fitness())
+      this->pop.push_back(best);
+    this->pop.sort();
+  }
+
+  /**
+   * @return best found solution
+   */
+  EORVT getSolution() {
+    return best;
+  }
+
+  /**
+   * @return current length scale
+   */
+  double getLengthScale() const {
+    return length;
+  }
+
+  /**
+   * @return number of points of the GP
+   */
+  unsigned int getNumPoints() const {
+    return m;
+  }
+
+  /// print
+  virtual void printOn(std::ostream& _os=std::cout) const {
+    BasePopulationSearchManager<eoObjFunc>::printOn(_os);
+    _os << " BO points : " << m << " length scale : " << length
+	<< " batches : " << gen << std::endl;
+  }
+
+ protected:
+
+  /**
+   * Initialize the GP by the initial design
+   */
+  virtual void initPS() {
+    n = lowerBound.size();
+    if(fixedLength > 0.0) length = fixedLength;
+    std::vector<double> u(n);
+    for(unsigned k=0;k<this->pop.size();k++) {
+      EORVT& x = this->pop[k];
+      if(x.invalid()) this->eval(x);
+      if(k == 0 || x.fitness() > best.fitness()) best = x;
+      toUnit(x,&u[0]);
+      add(&u[0],x.fitness());
+    }
+    refit();
+  }
+
+  /**
+   * select q points by the kriging believer, evaluate them concurrently and update the GP
+   */
+  void batch(unsigned int _q) {
+    std::vector<EORVT> points(_q);
+    std::vector<int> index(_q,-1);
+    std::vector<double> u(_q*n);
+    for(unsigned b=0;b<_q;b++) {
+      double* x = &u[b*n];
+      if(m > 0)
+	maximizeEI(x);
+      else
+	for(unsigned i=0;i<n;i++) x[i] = rng.uniform();
+      double mu, s2;
+      predict(x,mu,s2);
+      if(add(x,mu)) {
+	index[b] = m - 1;
+	solve();
+      }
+      fromUnit(x,points[b]);
+    }
+    this->archiveEval.setStep(++gen);
+    ParallelEval::evaluate(points,this->archiveEval,this->eval);
+    for(unsigned b=0;b<_q;b++) {
+      double f = points[b].fitness();
+      if(index[b] >= 0)
+	Y[index[b]] = f;
+      else
+	add(&u[b*n],f);
+      if(points[b].fitness() > best.fitness()) best = points[b];
+    }
+    sinceRefit += _q;
+    if(sinceRefit >= refitEvery)
+      refit();
+    else
+      solve();
+  }
+
+  /**
+   * append a point to the GP, O(m^2)
+   *
+   * @param _x  point in [0,1]^n
+   * @param _f  objective value
+   * @return false if the point is numerically a duplicate
+   */
+  bool add(const double* _x,double _f) {
+    if(!(_f == _f) || std::fabs(_f) == HUGE_VAL) return false;   // NaN, inf
+    std::vector<double> k(m+1);
+    for(unsigned i=0;i<m;i++) k[i] = kernel(&X[i*n],_x,length);
+    if(!LinearAlgebra::choleskyAppendPacked(Lp,m,&k[0],1.0+nugget)) return false;
+    X.insert(X.end(),_x,_x+n);
+    Y.push_back(_f);
+    m++;
+    return true;
+  }
+
+  /**
+   * constant mean, weights alpha = K^-1 (y - mean) and profiled signal variance
+   */
+  void solve() {
+    ymean = 0.0;
+    for(unsigned i=0;i<m;i++) ymean += Y[i] / m;
+    alpha.resize(m);
+    for(unsigned i=0;i<m;i++) alpha[i] = Y[i] - ymean;
+    if(m == 0) return;
+    LinearAlgebra::choleskySolvePacked(&Lp[0],m,&alpha[0]);
+    double s = 0.0;
+    for(unsigned i=0;i<m;i++) s += (Y[i] - ymean) * alpha[i];
+    sigma2 = std::max(s / m,1e-300);
+  }
+
+  /**
+   * estimate the length scale (if not fixed) and rebuild the factor
+   */
+  void refit() {
+    sinceRefit = 0;
+    if(fixedLength <= 0.0 && m > 1) {
+      const int NUMLENGTHS = 12;
+      std::vector<double> ll(NUMLENGTHS);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+      for(int g=0;g<NUMLENGTHS;g++)
+	ll[g] = likelihood(lengthGrid(g,NUMLENGTHS));
+      int bestg = 0;
+      for(int g=1;g<NUMLENGTHS;g++)
+	if(ll[g] > ll[bestg]) bestg = g;
+      length = lengthGrid(bestg,NUMLENGTHS);
+    }
+    std::vector<double> X0, Y0;
+    X0.swap(X);
+    Y0.swap(Y);
+    unsigned m0 = m;
+    Lp.clear();
+    m = 0;
+    for(unsigned p=0;p<m0;p++) add(&X0[p*n],Y0[p]);
+    solve();
+  }
+
+  /// length scales from 0.02 to 2 (log scale)
+  static double lengthGrid(int _g,int _num) {
+    return 0.02 * std::pow(100.0,_g / (_num - 1.0));
+  }
+
+  /**
+   * @return profiled log likelihood of the length scale, O(m^3)
+   */
+  double likelihood(double _length) const {
+    std::vector<double> L, k(m), r(m);
+    double mean = 0.0;
+    for(unsigned i=0;i<m;i++) mean += Y[i] / m;
+    unsigned mm = 0;
+    double logdet = 0.0;
+    for(unsigned p=0;p<m;p++) {
+      for(unsigned i=0;i<mm;i++) k[i] = kernel(&X[i*n],&X[p*n],_length);
+      if(!LinearAlgebra::choleskyAppendPacked(L,mm,&k[0],1.0+nugget)) return -HUGE_VAL;
+      logdet += 2.0 * std::log(L.back());
+      r[mm] = Y[p] - mean;
+      mm++;
+    }
+    LinearAlgebra::forwardSubstPacked(&L[0],mm,&r[0]);
+    double s = LinearAlgebra::dot(&r[0],&r[0],mm) / mm;
+    return -0.5 * (mm * std::log(std::max(s,1e-300)) + logdet);
+  }
+
+  /**
+   * posterior mean and variance at _x, O(m^2), reentrant
+   */
+  void predict(const double* _x,double& _mu,double& _s2) const {
+    std::vector<double> k(m);
+    for(unsigned i=0;i<m;i++) k[i] = kernel(&X[i*n],_x,length);
+    _mu = ymean + (m > 0 ? LinearAlgebra::dot(&k[0],&alpha[0],m) : 0.0);
+    if(m > 0) LinearAlgebra::forwardSubstPacked(&Lp[0],m,&k[0]);
+    double v = m > 0 ? LinearAlgebra::dot(&k[0],&k[0],m) : 0.0;
+    _s2 = sigma2 * std::max(1.0 + nugget - v,1e-12);
+  }
+
+  /**
+   * @return expected improvement over the best objective value at _x, reentrant
+   */
+  double expectedImprovement(const double* _x) const {
+    double mu, s2;
+    predict(_x,mu,s2);
+    double s = std::sqrt(s2);
+    double d = (double) best.fitness() - mu;
+    double z = d / s;
+    return d * 0.5 * erfc(-z / std::sqrt(2.0)) + s * 0.3989422804014327 * std::exp(-0.5 * z * z);
+  }
+
+  /**
+   * maximize the expected improvement by concurrent pattern searches
+   * from the best point and the most promising random points
+   *
+   * @param _x best found point in [0,1]^n
+   */
+  void maximizeEI(double* _x) {
+    unsigned numCandidates = 10 * numStarts;
+    std::vector<double> starts(numCandidates*n), ei(numCandidates);
+    toUnit(best,&starts[0]);
+    for(unsigned i=n;i<numCandidates*n;i++) starts[i] = rng.uniform();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int c=1;c<(int) numCandidates;c++)
+      ei[c] = expectedImprovement(&starts[c*n]);
+    // the best point and the most promising candidates
+    std::vector<unsigned> order(numCandidates);
+    for(unsigned c=0;c<numCandidates;c++) order[c] = c;
+    ei[0] = HUGE_VAL;
+    std::partial_sort(order.begin(),order.begin()+numStarts,order.end(),RankCompare(ei,true));
+    std::vector<double> result(numStarts*n), value(numStarts);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+    for(int s=0;s<(int) numStarts;s++) {
+      double* x = &result[s*n];
+      std::copy(&starts[order[s]*n],&starts[order[s]*n]+n,x);
+      value[s] = patternSearch(x);
+    }
+    unsigned bests = 0;
+    for(unsigned s=1;s<numStarts;s++)
+      if(value[s] > value[bests]) bests = s;
+    std::copy(&result[bests*n],&result[bests*n]+n,_x);
+  }
+
+  /**
+   * compass search of the expected improvement within [0,1]^n
+   *
+   * @param _x on input the start, on output the best found point
+   * @return expected improvement at _x
+   */
+  double patternSearch(double* _x) const {
+    double f = expectedImprovement(_x);
+    double step = 0.1;
+    while(step > 1e-3) {
+      bool improved = false;
+      for(unsigned i=0;i<n;i++) {
+	double xi = _x[i];
+	for(int sgn=-1;sgn<=1;sgn+=2) {
+	  _x[i] = std::min(std::max(xi + sgn * step,0.0),1.0);
+	  double g = expectedImprovement(_x);
+	  if(g > f) {
+	    f = g;
+	    xi = _x[i];
+	    improved = true;
+	    break;
+	  }
+	}
+	_x[i] = xi;
+      }
+      if(!improved) step *= 0.5;
+    }
+    return f;
+  }
+
+  /// Matern 5/2 kernel
+  double kernel(const double* _a,const double* _b,double _length) const {
+    double d = 0.0;
+    for(unsigned j=0;j<n;j++) d += (_a[j] - _b[j]) * (_a[j] - _b[j]);
+    double r = std::sqrt(5.0 * d) / _length;
+    return (1.0 + r + r * r / 3.0) * std::exp(-r);
+  }
+
+  /// scale a solution into [0,1]^n
+  void toUnit(const EORVT& _x,double* _u) const {
+    for(unsigned i=0;i<n;i++) {
+      double w = upperBound[i] - lowerBound[i];
+      _u[i] = w > 0.0 ? ((double) _x[i] - lowerBound[i]) / w : 0.5;
+    }
+  }
+
+  /// scale a point of [0,1]^n into the box
+  void fromUnit(const double* _u,EORVT& _x) const {
+    _x.resize(n);
+    for(unsigned i=0;i<n;i++) _x[i] = lowerBound[i] + _u[i] * (upperBound[i] - lowerBound[i]);
+    _x.invalidate();
+  }
+
+  /**
+   * \class RankCompare
+   * ascending (descending) order of values
+   */
+  class RankCompare {
+  public:
+    RankCompare(const std::vector<double>& _values,bool _descending=false) : values(_values),descending(_descending) { }
+    bool operator()(unsigned _a,unsigned _b) const {
+      return descending ? values[_a] > values[_b] : values[_a] < values[_b];
+    }
+  private:
+    const std::vector<double>& values;
+    bool descending;
+  };
+
+  vector<double> lowerBound;     ///> lower bound of the search space
+  vector<double> upperBound;     ///> upper bound of the search space
+  EORVT          best;           ///> best ever found individual
+  unsigned int   maxEval;        ///> max. num. of function evaluations (0: unbounded)
+  unsigned int   batchSize;      ///> number of points per batch
+  unsigned int   numStarts;      ///> number of starts of the acquisition optimization
+  unsigned int   refitEvery;     ///> number of new points between length scale estimations
+  double         fixedLength;    ///> user defined length scale (0: estimated)
+  double         length;         ///> length scale
+  double         nugget;         ///> regularization of the kernel matrix
+
+  unsigned int   n;              ///> dimension
+  unsigned int   m;              ///> number of points of the GP
+  vector<double> X;              ///> points in [0,1]^n (m x n)
+  vector<double> Y;              ///> objective values (or predicted values of pending points)
+  vector<double> Lp;             ///> packed Cholesky factor of the kernel matrix
+  vector<double> alpha;          ///> K^-1 (y - mean)
+  double         ymean;          ///> constant mean
+  double         sigma2;         ///> signal variance
+  unsigned int   sinceRefit;     ///> number of points since the last estimation
+  unsigned int   gen;            ///> number of batches
+
+};
+
+#endif
@@ -0,0 +1,545 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+/**
+ * \file  PopulationSearchManagerCMAES.h
+ *
+ * @date: Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+
+#ifndef _PopulationSearchManagerCMAES_h
+#define _PopulationSearchManagerCMAES_h
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "PopulationSearchManager.h"
+#include "util/LinearAlgebra.h"
+#include "util/ParallelEval.h"
+
+using namespace std;
+
+
+/**
+ * \class PopulationSearchManagerCMAES
+ *
+ * Covariance Matrix Adaptation Evolution Strategy, (mu/mu_w,lambda)-CMA-ES
+ * with optional IPOP restarts (population size is increased after each restart)
+ *
+ * - the lambda offspring of a generation are evaluated on the worker pool (@see ParallelEval)
+ * - rank-one and rank-mu updates of the covariance matrix use cache blocked kernels
+ * - the eigen decomposition of the covariance matrix is updated lazily,
+ *   i.e. each 1/(c1+cmu)/n/10 generations
+ * - with bounds each offspring is projected onto the box before its evaluation,
+ *   it is ranked by its objective value (minimized) plus a penalty on the squared
+ *   distance of the projection, weighted by the spread of the objective values of
+ *   the generation s.t. the mean does not drift out of the box. The update uses
+ *   the unprojected samples.
+ */
+template<class eoObjFunc>
+class PopulationSearchManagerCMAES : public BasePopulationSearchManager<eoObjFunc> {
+
+ public:
+
+  /**
+   * Basic constructor, the mean of the search distribution starts
+   * at the best individual of a random population within bounds
+   *
+   * @param _lowerBound lower bound of initial population
+   * @param _upperBound upper bound of initial population
+   * @param _POP_SIZE   number of offspring lambda (0: default 4 + 3 ln(n))
+   * @param _MAX_GEN    maximum number of generations of a single run
+   * @param _SEED       random seed
+   */
+  PopulationSearchManagerCMAES(const vector<double>& _lowerBound,
+			       const vector<double>& _upperBound,
+			       unsigned int _POP_SIZE=0,
+			       unsigned int _MAX_GEN=100000,
+			       unsigned int _SEED=time(0))
+    : BasePopulationSearchManager<eoObjFunc>(_lowerBound,_upperBound,_POP_SIZE,_MAX_GEN,_SEED),
+    lowerBound(_lowerBound),upperBound(_upperBound),bounded(!_lowerBound.empty()),lambda0(_POP_SIZE),maxEval(0),
+    ipop(false),maxRestarts(0),incPopSize(2.0),restarts(0),
+    tolFun(1e-12),tolX(1e-12),numRepaired(0),gen(0),totalGen(0) {
+    sigma0 = 0.0;
+    for(unsigned i=0;i<lowerBound.size();i++)
+      sigma0 += 0.3 * (upperBound[i] - lowerBound[i]);
+    sigma0 /= lowerBound.size();
+    if(this->pop.size() > 0)
+      initial = this->pop.best_element();
+    else
+      Utilities::getRandomSolution(initial,lowerBound,upperBound);
+  }
+
+  /**
+   * Basic constructor with an initial point
+   *
+   * @param _initial    initial mean of the search distribution
+   * @param _sigma      initial step size
+   * @param _POP_SIZE   number of offspring lambda (0: default 4 + 3 ln(n))
+   * @param _MAX_GEN    maximum number of generations of a single run
+   * @param _SEED       random seed
+   */
+  PopulationSearchManagerCMAES(const EORVT& _initial,
+			       double _sigma,
+			       unsigned int _POP_SIZE=0,
+			       unsigned int _MAX_GEN=100000,
+			       unsigned int _SEED=time(0))
+    : BasePopulationSearchManager<eoObjFunc>(singleton(_initial),_MAX_GEN),
+    bounded(false),initial(_initial),sigma0(_sigma),lambda0(_POP_SIZE),maxEval(0),
+    ipop(false),maxRestarts(0),incPopSize(2.0),restarts(0),
+    tolFun(1e-12),tolX(1e-12),numRepaired(0),gen(0),totalGen(0) {
+    this->setSeed(_SEED);
+  }
+
+  /// Destructor
+  virtual ~PopulationSearchManagerCMAES() { }
+
+  /**
+   * append all sampled points to a memory mapped archive
+   *
+   * @param _file  archive file
+   * @return false if the archive cannot be opened
+   */
+  virtual bool setArchive(const std::string& _file) {
+    return this->archiveEval.open(_file,initial.size());
+  }
+
+  /**
+   * consult a persistent cache of objective values
+   *
+   * @param _file      cache file
+   * @param _capacity  max. number of cached points of a new cache
+   * @param _identity  identity of the objective function (empty: RSRRMVOF::identity())
+   * @return false if the cache cannot be opened
+   */
+  virtual bool setCache(const std::string& _file,unsigned long long _capacity=1048576,const std::string& _identity="") {
+    return this->cacheEval.open(_file,initial.size(),_capacity,
+				_identity.empty() ? this->evalFunc.identity() : _identity);
+  }
+
+  /**
+   * set stopping criteria max num. of function evaluation,
+   * checked once per generation (overshoot < lambda)
+   *
+   * @param _maxeval max. num. of function evaluation
+   */
+  void setMaxFuncEval(unsigned int _maxeval) {
+    maxEval = _maxeval;
+  }
+
+  /**
+   * enable IPOP restarts, the population size is multiplied by
+   * _incPopSize after each restart
+   *
+   * @param _maxRestarts max. number of restarts
+   * @param _incPopSize  increase factor of the population size
+   */
+  void setIPOP(unsigned int _maxRestarts=9,double _incPopSize=2.0) {
+    if(this->INITIALIZED) std::cerr << "setIPOP::object already initialized\n";
+    ipop = true;
+    maxRestarts = _maxRestarts;
+    incPopSize = _incPopSize;
+  }
+
+  /**
+   * confine the offspring to bounds (set by the constructor with bounds), 
+   * the restarts of IPOP then start at random points within the bounds 
+   *
+   * @param _lowerBound lower bounds
+   * @param _upperBound upper bounds
+   */
+  void setBounds(const vector<double>& _lowerBound,const vector<double>& _upperBound) {
+    if(this->INITIALIZED) std::cerr << "setBounds::object already initialized\n";
+    lowerBound = _lowerBound;
+    upperBound = _upperBound;
+    bounded = !lowerBound.empty();
+  }
+
+  /**
+   * @return number of offspring projected onto the bounds
+   */
+  unsigned long getNumRepaired() const {
+    return numRepaired;
+  }
+
+  /**
+   * set tolerances of the stopping criteria of a single run
+   *
+   * @param _tolFun  range of best fitness values over the recent generations
+   * @param _tolX    (relative to the initial step size) standard deviation in all coordinates
+   */
+  void setTolerances(double _tolFun,double _tolX) {
+    tolFun = _tolFun;
+    tolX = _tolX;
+  }
+
+  /**
+   * execution
+   */
+  virtual void run() {
+    if(!this->INITIALIZED) {
+      std::cerr << "initialization should be done by calling PopulationSearchManagerCMAES::init()" << std::endl;
+      return;
+    }
+    bool stop = false;
+    while(!stop) {
+      while(!budgetExhausted() && !converged())
+	generation();
+      stop = budgetExhausted() || !ipop || restarts >= maxRestarts;
+      if(!stop) {
+	restarts++;
+	lambda = (unsigned) (lambda * incPopSize);
+	if(lowerBound.size() > 0)
+	  Utilities::getRandomSolution(initial,lowerBound,upperBound);
+	initStrategy();
+      }
+    }
+    // keep the best ever found individual within the final population
+    if(this->pop.size() == 0 || best.fitness() > this->pop.best_element().fitness())
+      this->pop.push_back(best);
+    this->pop.sort();
+  }
+
+  /**
+   * @return best found solution
+   */
+  EORVT getSolution() {
+    return best;
+  }
+
+  /**
+   * @return current step size
+   */
+  double getSigma() const {
+    return sigma;
+  }
+
+  /**
+   * @return number of performed restarts
+   */
+  unsigned int getNumRestarts() const {
+    return restarts;
+  }
+
+  /// print
+  virtual void printOn(std::ostream& _os=std::cout) const {
+    BasePopulationSearchManager<eoObjFunc>::printOn(_os);
+    _os << " CMA-ES sigma : " << sigma << " lambda : " << lambda
+	<< " restarts : " << restarts << std::endl;
+    if(numRepaired > 0)
+      _os << " infeasible offspring repaired : " << numRepaired << std::endl;
+  }
+
+ protected:
+
+  /**
+   * Initialize population search
+   */
+  virtual void initPS() {
+    if(bounded && project(initial) > 0.0) initial.invalidate();
+    if(initial.invalid()) this->eval(initial);
+    best = initial;
+    n = initial.size();
+    lambda = lambda0 > 0 ? lambda0 : 4 + (unsigned) (3.0 * std::log((double) n));
+    initStrategy();
+  }
+
+  /**
+   * (re-)initialize the strategy parameters and the state of the search distribution
+   */
+  void initStrategy() {
+    if(lambda < 2) lambda = 2;
+    mu = lambda / 2;
+    weights.resize(mu);
+    double sumw = 0.0, sumw2 = 0.0;
+    for(unsigned i=0;i<mu;i++) {
+      weights[i] = std::log(mu + 0.5) - std::log(i + 1.0);
+      sumw += weights[i];
+    }
+    for(unsigned i=0;i<mu;i++) {
+      weights[i] /= sumw;
+      sumw2 += weights[i] * weights[i];
+    }
+    mueff = 1.0 / sumw2;
+
+    double N = n;
+    cc = (4.0 + mueff/N) / (N + 4.0 + 2.0*mueff/N);
+    cs = (mueff + 2.0) / (N + mueff + 5.0);
+    c1 = 2.0 / ((N+1.3)*(N+1.3) + mueff);
+    cmu = std::min(1.0 - c1, 2.0 * (mueff - 2.0 + 1.0/mueff) / ((N+2.0)*(N+2.0) + mueff));
+    damps = 1.0 + 2.0 * std::max(0.0, std::sqrt((mueff-1.0)/(N+1.0)) - 1.0) + cs;
+    chiN = std::sqrt(N) * (1.0 - 1.0/(4.0*N) + 1.0/(21.0*N*N));
+    eigenGap = std::max(1u, (unsigned) (1.0 / ((c1+cmu) * N * 10.0)));
+
+    mean.assign(initial.begin(),initial.end());
+    sigma = sigma0;
+    pc.assign(n,0.0);
+    ps.assign(n,0.0);
+    C.assign(n*n,0.0);
+    B.assign(n*n,0.0);
+    BD.assign(n*n,0.0);
+    D.assign(n,1.0);
+    for(unsigned i=0;i<n;i++) {
+      C[i*n+i] = 1.0;
+      B[i*n+i] = 1.0;
+      BD[i*n+i] = 1.0;
+    }
+    arz.resize(lambda*n);
+    ary.resize(lambda*n);
+    ymu.resize(mu*n);
+    offspring.resize(lambda);
+    for(unsigned k=0;k<lambda;k++) offspring[k].resize(n);
+    ranking.resize(lambda);
+    values.resize(lambda);
+    repairDist.assign(lambda,0.0);
+    history.clear();
+    gen = 0;
+    lastEigen = 0;
+  }
+
+  /**
+   * one generation: sample, evaluate, update
+   */
+  void generation() {
+    // sample lambda offspring x_k = m + sigma * B * D * z_k
+    for(unsigned i=0;i<lambda*n;i++) arz[i] = rng.normal();
+    LinearAlgebra::multABt(&arz[0],&BD[0],&ary[0],lambda,n,n);
+    for(unsigned k=0;k<lambda;k++) {
+      for(unsigned i=0;i<n;i++)
+	offspring[k][i] = mean[i] + sigma * ary[k*n+i];
+      offspring[k].invalidate();
+      if(bounded) repairDist[k] = project(offspring[k]);
+    }
+
+    // archived points are tagged by the generation counted over all restarts
+    this->archiveEval.setStep(++totalGen);
+    ParallelEval::evaluate(offspring,this->archiveEval,this->eval);
+
+    for(unsigned k=0;k<lambda;k++) {
+      ranking[k] = k;
+      values[k] = offspring[k].fitness();
+      if(offspring[k].fitness() > best.fitness())
+	best = offspring[k];
+    }
+    history.push_back(*std::min_element(values.begin(),values.end()));
+    if(bounded) penalize();
+    std::sort(ranking.begin(),ranking.end(),RankCompare(values));
+
+    // recombination
+    std::vector<double> ymean(n,0.0), zmean(n,0.0);
+    for(unsigned i=0;i<mu;i++) {
+      const double* y = &ary[ranking[i]*n];
+      const double* z = &arz[ranking[i]*n];
+      double w = weights[i];
+      double sw = std::sqrt(w);
+      for(unsigned j=0;j<n;j++) {
+	ymean[j] += w * y[j];
+	zmean[j] += w * z[j];
+	ymu[i*n+j] = sw * y[j];
+      }
+    }
+    for(unsigned j=0;j<n;j++) mean[j] += sigma * ymean[j];
+
+    // cumulation: B * zmean == C^{-1/2} * ymean w.r.t. the current decomposition
+    std::vector<double> bz(n);
+    LinearAlgebra::multAx(&B[0],&zmean[0],&bz[0],n,n);
+    double csn = std::sqrt(cs * (2.0 - cs) * mueff);
+    for(unsigned j=0;j<n;j++) ps[j] = (1.0 - cs) * ps[j] + csn * bz[j];
+    double psnorm = std::sqrt(LinearAlgebra::dot(&ps[0],&ps[0],n));
+    gen++;
+    bool hsig = psnorm / std::sqrt(1.0 - std::pow(1.0 - cs, 2.0 * gen)) / chiN < 1.4 + 2.0/(n + 1.0);
+    double ccn = std::sqrt(cc * (2.0 - cc) * mueff);
+    for(unsigned j=0;j<n;j++) pc[j] = (1.0 - cc) * pc[j] + (hsig ? ccn * ymean[j] : 0.0);
+
+    // covariance matrix: rank-one and rank-mu update
+    double decay = 1.0 - c1 - cmu + (hsig ? 0.0 : c1 * cc * (2.0 - cc));
+    for(unsigned i=0;i<n*n;i++) C[i] *= decay;
+    LinearAlgebra::rankUpdate(c1,&pc[0],1,n,&C[0]);
+    LinearAlgebra::rankUpdate(cmu,&ymu[0],mu,n,&C[0]);
+
+    // step size
+    sigma *= std::exp((cs / damps) * (psnorm / chiN - 1.0));
+
+    // lazy eigen decomposition
+    if(gen - lastEigen >= eigenGap) {
+      updateEigen();
+      lastEigen = gen;
+    }
+
+    this->pop.resize(lambda);
+    for(unsigned k=0;k<lambda;k++) this->pop[k] = offspring[ranking[k]];
+  }
+
+  /**
+   * @return a population consisting of a single individual
+   */
+  static eoPop<EORVT> singleton(const EORVT& _initial) {
+    eoPop<EORVT> p;
+    p.push_back(_initial);
+    return p;
+  }
+
+  /**
+   * project a point onto the bounds
+   *
+   * @return squared distance of the projection
+   */
+  double project(EORVT& _x) {
+    double dist = 0.0;
+    for(unsigned i=0;i<_x.size() && i<lowerBound.size();i++) {
+      double y = std::min(std::max((double) _x[i],lowerBound[i]),upperBound[i]);
+      dist += (y - _x[i]) * (y - _x[i]);
+      _x[i] = y;
+    }
+    return dist;
+  }
+
+  /**
+   * add the penalty of the projection to the ranking values: a projection 
+   * by one standard deviation in each coordinate costs twice the 
+   * interquartile range of the objective values of the generation
+   */
+  void penalize() {
+    std::vector<double> sorted(values);
+    std::sort(sorted.begin(),sorted.end());
+    double dfit = std::max(sorted[(3 * lambda) / 4] - sorted[lambda / 4],1e-300);
+    double trace = 0.0;
+    for(unsigned i=0;i<n;i++) trace += C[i*n+i];
+    double gamma = 2.0 * dfit / (sigma * sigma * trace);
+    for(unsigned k=0;k<lambda;k++)
+      if(repairDist[k] > 0.0) {
+	values[k] += gamma * repairDist[k];
+	numRepaired++;
+      }
+  }
+
+  /**
+   * update B, D and B*D from C
+   */
+  void updateEigen() {
+    std::vector<double> V(C);
+    LinearAlgebra::symmetricEigen(n,V,D);
+    B.swap(V);
+    for(unsigned i=0;i<n;i++)
+      D[i] = std::sqrt(std::max(D[i],1e-20));
+    for(unsigned i=0;i<n;i++)
+      for(unsigned j=0;j<n;j++)
+	BD[i*n+j] = B[i*n+j] * D[j];
+  }
+
+  /**
+   * @return whether the evaluation or generation budget is exhausted
+   */
+  bool budgetExhausted() {
+    if(maxEval > 0 && this->eval.value() >= maxEval) return true;
+    return gen >= this->MAX_GEN;
+  }
+
+  /**
+   * @return whether the current run has converged or stagnated
+   */
+  bool converged() {
+    // no effect of the step size in any coordinate
+    double maxsd = 0.0;
+    for(unsigned i=0;i<n;i++) maxsd = std::max(maxsd,std::sqrt(C[i*n+i]));
+    if(sigma * maxsd < tolX * sigma0) return true;
+    // condition number of C
+    double dmin = *std::min_element(D.begin(),D.end());
+    double dmax = *std::max_element(D.begin(),D.end());
+    if(dmax > 1e7 * dmin) return true;
+    // flat fitness over recent generations
+    unsigned hlen = 10 + (unsigned) std::ceil(30.0 * n / lambda);
+    if(history.size() >= hlen) {
+      double fmin = history[history.size()-hlen], fmax = fmin;
+      for(unsigned i=history.size()-hlen;i<history.size();i++) {
+	fmin = std::min(fmin,history[i]);
+	fmax = std::max(fmax,history[i]);
+      }
+      if(fmax - fmin < tolFun) return true;
+    }
+    return false;
+  }
+
+  /**
+   * \class RankCompare
+   * ascending order of the (penalized) objective value
+   */
+  class RankCompare {
+  public:
+    RankCompare(const std::vector<double>& _values) : values(_values) { }
+    bool operator()(unsigned _a,unsigned _b) const {
+      return values[_a] < values[_b];
+    }
+  private:
+    const std::vector<double>& values;
+  };
+
+  vector<double> lowerBound;     ///> lower bound for restarts
+  vector<double> upperBound;     ///> upper bound for restarts
+  bool           bounded;        ///> whether the offspring are confined to the bounds
+  EORVT          initial;        ///> initial mean
+  EORVT          best;           ///> best ever found individual
+  double         sigma0;         ///> initial step size
+  unsigned int   lambda0;        ///> user defined number of offspring
+  unsigned int   maxEval;        ///> max. num. of function evaluations (0: unbounded)
+
+  bool           ipop;           ///> whether IPOP restarts are enabled
+  unsigned int   maxRestarts;    ///> max. number of restarts
+  double         incPopSize;     ///> increase factor of population size
+  unsigned int   restarts;       ///> number of performed restarts
+  double         tolFun;         ///> tolerance of fitness values
+  double         tolX;           ///> tolerance of step size
+  unsigned long  numRepaired;    ///> number of projected offspring
+
+  unsigned int   n;              ///> dimension
+  unsigned int   lambda;         ///> number of offspring
+  unsigned int   mu;             ///> number of parents
+  vector<double> weights;        ///> recombination weights
+  double mueff,cc,cs,c1,cmu,damps,chiN;  ///> strategy parameters
+
+  vector<double> mean;           ///> mean of search distribution
+  double         sigma;          ///> step size
+  vector<double> pc;             ///> evolution path of C
+  vector<double> ps;             ///> evolution path of sigma
+  vector<double> C;              ///> covariance matrix (n x n)
+  vector<double> B;              ///> eigenvectors of C (n x n)
+  vector<double> D;              ///> sqrt of eigenvalues of C
+  vector<double> BD;             ///> B * diag(D)
+
+  vector<double> arz;            ///> standard normal samples (lambda x n)
+  vector<double> ary;            ///> B*D*z (lambda x n)
+  vector<double> ymu;            ///> sqrt(w)-scaled selected steps (mu x n)
+  vector<EORVT>  offspring;      ///> offspring
+  vector<unsigned> ranking;      ///> ranking of offspring
+  vector<double> values;         ///> (penalized) objective values of offspring
+  vector<double> repairDist;     ///> squared distance of the projection of offspring
+  vector<double> history;        ///> best fitness per generation
+
+  unsigned int   gen;            ///> generation counter of the current run
+  unsigned long  totalGen;       ///> generation counter over all restarts
+  unsigned int   lastEigen;      ///> generation of the last eigen decomposition
+  unsigned int   eigenGap;       ///> generations between eigen decompositions
+
+};
+
+#endif
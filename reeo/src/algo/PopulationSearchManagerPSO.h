@@ -0,0 +1,424 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+/**
+ * \file  PopulationSearchManagerPSO.h
+ *
+ * @date: Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+
+#ifndef _PopulationSearchManagerPSO_h
+#define _PopulationSearchManagerPSO_h
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "PopulationSearchManager.h"
+#include "util/ParallelEval.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace std;
+
+
+/**
+ * \class PopulationSearchManagerPSO
+ *
+ * Particle swarm optimization with constriction coefficients, the initial
+ * population gives the initial positions
+ *
+ * - positions, velocities and personal bests are stored as contiguous
+ *   structure of arrays (dimension-major, x[i*P+p]), s.t. the update of a
+ *   coordinate over all particles is a contiguous loop which the compiler
+ *   vectorizes (-O3)
+ * - the guide of a particle is the global best or the best personal best in
+ *   its ring neighborhood (p-1,p,p+1)
+ * - synchronous mode: all particles move, then they are evaluated
+ *   concurrently (@see ParallelEval) and the bests are updated
+ * - asynchronous mode: a worker thread claims the next free particle in
+ *   round robin by compare-and-swap, moves and evaluates it without a
+ *   generational barrier. A personal best is published under a sequence lock
+ *   (odd: being written, @see EvalCache), the global and the neighborhood
+ *   bests are particle indices updated by compare-and-swap. Readers never
+ *   block. A concurrent improvement may be lost in a best slot until the
+ *   particle improves again.
+ */
+template<class eoObjFunc>
+class PopulationSearchManagerPSO : public BasePopulationSearchManager<eoObjFunc> {
+
+ public:
+
+  /**
+   * Basic constructor
+   *
+   * @param _lowerBound lower bound of the search space
+   * @param _upperBound upper bound of the search space
+   * @param _POP_SIZE   number of particles
+   * @param _MAX_GEN    maximum number of generations (asynchronous: evaluations / particles)
+   * @param _SEED       random seed
+   */
+  PopulationSearchManagerPSO(const vector<double>& _lowerBound,
+			     const vector<double>& _upperBound,
+			     unsigned int _POP_SIZE=20,
+			     unsigned int _MAX_GEN=500,
+			     unsigned int _SEED=time(0))
+    : BasePopulationSearchManager<eoObjFunc>(_lowerBound,_upperBound,_POP_SIZE,_MAX_GEN,_SEED),
+    lowerBound(_lowerBound),upperBound(_upperBound),maxEval(0),
+    inertia(0.7298),cognitive(1.49618),social(1.49618),maxVelocity(0.2),
+    ring(false),asynchronous(false),gen(0) { }
+
+  /// Destructor
+  virtual ~PopulationSearchManagerPSO() { }
+
+  /**
+   * set stopping criteria max num. of function evaluation (including the initial population)
+   *
+   * @param _maxeval max. num. of function evaluation
+   */
+  void setMaxFuncEval(unsigned int _maxeval) {
+    maxEval = _maxeval;
+  }
+
+  /**
+   * set the coefficients of the velocity update
+   * v = w v + c1 r1 (pbest - x) + c2 r2 (guide - x)
+   *
+   * @param _inertia      inertia weight w
+   * @param _cognitive    attraction c1 to the personal best
+   * @param _social       attraction c2 to the guide
+   * @param _maxVelocity  max. velocity relative to the bounds
+   */
+  void setCoefficients(double _inertia,double _cognitive,double _social,double _maxVelocity=0.2) {
+    inertia = _inertia;
+    cognitive = _cognitive;
+    social = _social;
+    maxVelocity = _maxVelocity;
+  }
+
+  /**
+   * set the ring topology, i.e. particles are guided by their neighborhood best
+   */
+  void setRingTopology(bool _ring=true) {
+    ring = _ring;
+  }
+
+  /**
+   * set the asynchronous mode without generational barrier
+   */
+  void setAsynchronous(bool _asynchronous=true) {
+    asynchronous = _asynchronous;
+  }
+
+  /**
+   * execution
+   */
+  virtual void run() {
+    if(!this->INITIALIZED) {
+      std::cerr << "initialization should be done by calling PopulationSearchManagerPSO::init()" << std::endl;
+      return;
+    }
+    if(P == 0) return;
+    if(asynchronous)
+      runAsynchronous();
+    else
+      while(gen < this->MAX_GEN && remaining() > 0)
+	generation();
+    // the personal bests are the final population
+    this->pop.resize(P);
+    for(unsigned p=0;p<P;p++) {
+      gather(&pbest[0],p,this->pop[p]);
+      this->pop[p].fitness((double) best[p].f);
+    }
+    this->pop.sort();
+  }
+
+  /**
+   * @return best found solution
+   */
+  EORVT getSolution() {
+    EORVT x;
+    gather(&pbest[0],gbest,x);
+    x.fitness((double) best[gbest].f);
+    return x;
+  }
+
+  /// print
+  virtual void printOn(std::ostream& _os=std::cout) const {
+    BasePopulationSearchManager<eoObjFunc>::printOn(_os);
+    _os << " PSO generations : " << gen << (asynchronous ? " (asynchronous)" : "") << std::endl;
+  }
+
+ protected:
+
+  /**
+   * Initialize positions, velocities and bests by the initial population
+   */
+  virtual void initPS() {
+    n = lowerBound.size();
+    P = this->pop.size();
+    x.resize(n * P);
+    v.resize(n * P);
+    pbest.resize(n * P);
+    best.assign(P,Best());
+    vmax.resize(n);
+    for(unsigned i=0;i<n;i++) vmax[i] = maxVelocity * (upperBound[i] - lowerBound[i]);
+    gbest = 0;
+    for(unsigned p=0;p<P;p++) {
+      EORVT& ind = this->pop[p];
+      if(ind.invalid()) this->eval(ind);
+      for(unsigned i=0;i<n;i++) {
+	x[i*P+p] = pbest[i*P+p] = ind[i];
+	v[i*P+p] = vmax[i] * (2.0 * rng.uniform() - 1.0);
+      }
+      best[p].f = ind.fitness();
+      if(best[p].f < best[gbest].f) gbest = p;
+    }
+    for(unsigned p=0;p<P;p++) {
+      unsigned q = p;
+      for(int k=-1;k<=1;k+=2) {
+	unsigned r = (p + P + k) % P;
+	if(best[r].f < best[q].f) q = r;
+      }
+      best[p].lbest = q;
+    }
+  }
+
+  /**
+   * synchronous generation: move all particles, evaluate them concurrently, update the bests
+   */
+  void generation() {
+    unsigned q = std::min<unsigned long>(P,remaining());
+    r1.resize(n * P);
+    r2.resize(n * P);
+    for(unsigned k=0;k<n*q;k++) {
+      r1[k] = rng.uniform();
+      r2[k] = rng.uniform();
+    }
+    std::vector<unsigned> guide(q);
+    for(unsigned p=0;p<q;p++) guide[p] = ring ? best[p].lbest : gbest;
+    for(unsigned i=0;i<n;i++) {
+      double*       xi = &x[i*P];
+      double*       vi = &v[i*P];
+      const double* bi = &pbest[i*P];
+      const double* a  = &r1[i*q];
+      const double* b  = &r2[i*q];
+      double lo = lowerBound[i], hi = upperBound[i], vm = vmax[i];
+      for(unsigned p=0;p<q;p++) {
+	double vp = inertia * vi[p] + cognitive * a[p] * (bi[p] - xi[p]) + social * b[p] * (bi[guide[p]] - xi[p]);
+	vp = std::min(std::max(vp,-vm),vm);
+	double xp = xi[p] + vp;
+	// stop at the bounds
+	if(xp < lo || xp > hi) {
+	  xp = std::min(std::max(xp,lo),hi);
+	  vp = 0.0;
+	}
+	vi[p] = vp;
+	xi[p] = xp;
+      }
+    }
+    offspring.resize(q);
+    for(unsigned p=0;p<q;p++) gather(&x[0],p,offspring[p]);
+    this->archiveEval.setStep(++gen);
+    ParallelEval::evaluate(offspring,this->archiveEval,this->eval);
+    for(unsigned p=0;p<q;p++) {
+      double f = offspring[p].fitness();
+      if(f < best[p].f) {
+	best[p].f = f;
+	for(unsigned i=0;i<n;i++) pbest[i*P+p] = x[i*P+p];
+	if(f < best[gbest].f) gbest = p;
+	for(int k=-1;k<=1;k++) {
+	  unsigned r = (p + P + k) % P;
+	  if(f < best[best[r].lbest].f) best[r].lbest = p;
+	}
+      }
+    }
+  }
+
+  /**
+   * asynchronous mode: worker threads move and evaluate the next free particle
+   */
+  void runAsynchronous() {
+    unsigned long limit = (unsigned long) this->MAX_GEN * P;
+    if(maxEval > 0) limit = std::min(limit,remaining());
+    issued = 0;
+    cursor = 0;
+    int T = std::min<int>(ParallelEval::numThreads(),P);
+    std::vector<unsigned long long> seeds(T);
+    for(int t=0;t<T;t++) seeds[t] = rng.rand() * 2654435761ULL + t + 1;
+    this->archiveEval.setStep(++gen);
+#ifdef _OPENMP
+#pragma omp parallel num_threads(T)
+#endif
+    {
+      int t = ParallelEval::threadId();
+      Random random(seeds[t]);
+      std::vector<double> g(n);
+      EORVT ind(n);
+      for(;;) {
+	if(__sync_fetch_and_add(&issued,1UL) >= limit) break;
+	// at most T-1 other particles are busy
+	unsigned p;
+	do p = __sync_fetch_and_add(&cursor,1UL) % P;
+	while(!__sync_bool_compare_and_swap(&best[p].busy,0U,1U));
+	readBest(ring ? best[p].lbest : gbest,&g[0]);
+	for(unsigned i=0;i<n;i++) {
+	  unsigned k = i*P+p;
+	  double vp = inertia * v[k] + cognitive * random.uniform() * (pbest[k] - x[k])
+	    + social * random.uniform() * (g[i] - x[k]);
+	  vp = std::min(std::max(vp,-vmax[i]),vmax[i]);
+	  double xp = x[k] + vp;
+	  if(xp < lowerBound[i] || xp > upperBound[i]) {
+	    xp = std::min(std::max(xp,lowerBound[i]),upperBound[i]);
+	    vp = 0.0;
+	  }
+	  v[k] = vp;
+	  x[k] = ind[i] = xp;
+	}
+	ind.invalidate();
+	this->eval(ind);
+	double f = ind.fitness();
+	if(f < best[p].f) {
+	  // publish the personal best, only the claiming thread writes it
+	  best[p].seq++;
+	  __sync_synchronize();
+	  best[p].f = f;
+	  for(unsigned i=0;i<n;i++) pbest[i*P+p] = x[i*P+p];
+	  __sync_synchronize();
+	  best[p].seq++;
+	  offer(&gbest,p,f);
+	  for(int k=-1;k<=1;k++) offer(&best[(p + P + k) % P].lbest,p,f);
+	}
+	__sync_synchronize();
+	best[p].busy = 0;
+      }
+    }
+    // all evaluations up to the limit were issued
+    gen = std::max<unsigned long>(gen,limit / P);
+  }
+
+  /**
+   * replace the best index of a slot by compare-and-swap if _p is better
+   */
+  void offer(volatile unsigned int* _slot,unsigned int _p,double _f) {
+    for(;;) {
+      unsigned int q = *_slot;
+      if(q == _p || !(_f < readFitness(q))) return;
+      if(__sync_bool_compare_and_swap(_slot,q,_p)) return;
+    }
+  }
+
+  /// consistent read of a personal best value
+  double readFitness(unsigned int _p) const {
+    for(;;) {
+      unsigned long long s = best[_p].seq;
+      if(s & 1ULL) continue;
+      __sync_synchronize();
+      double f = best[_p].f;
+      __sync_synchronize();
+      if(best[_p].seq == s) return f;
+    }
+  }
+
+  /// consistent read of a personal best position
+  void readBest(unsigned int _p,double* _g) const {
+    for(;;) {
+      unsigned long long s = best[_p].seq;
+      if(s & 1ULL) continue;
+      __sync_synchronize();
+      for(unsigned i=0;i<n;i++) _g[i] = pbest[i*P+_p];
+      __sync_synchronize();
+      if(best[_p].seq == s) return;
+    }
+  }
+
+  /// copy the position of particle _p out of a structure of arrays
+  void gather(const double* _soa,unsigned int _p,EORVT& _x) const {
+    _x.resize(n);
+    for(unsigned i=0;i<n;i++) _x[i] = _soa[i*P+_p];
+    _x.invalidate();
+  }
+
+  /// @return num. of function evaluations left
+  unsigned long remaining() const {
+    if(maxEval == 0) return ~0UL;
+    return this->eval.value() < maxEval ? maxEval - this->eval.value() : 0;
+  }
+
+  /**
+   * \class Random
+   * xorshift64* generator of a worker thread
+   */
+  class Random {
+  public:
+    Random(unsigned long long _seed) : state(_seed ? _seed : 88172645463325252ULL) { }
+    double uniform() {
+      state ^= state >> 12;
+      state ^= state << 25;
+      state ^= state >> 27;
+      return ((state * 2685821657736338717ULL) >> 11) * (1.0 / 9007199254740992.0);
+    }
+  private:
+    unsigned long long state;
+  };
+
+  /**
+   * \struct Best
+   * published state of a particle
+   */
+  struct Best {
+    Best() : seq(0),f(0.0),lbest(0),busy(0) { }
+    volatile unsigned long long seq;   // odd: personal best being written
+    volatile double             f;     // personal best value
+    volatile unsigned int       lbest; // particle of the neighborhood best
+    volatile unsigned int       busy;  // 1: claimed by a worker thread
+  };
+
+  vector<double> lowerBound;     ///> lower bound of the search space
+  vector<double> upperBound;     ///> upper bound of the search space
+  unsigned int   maxEval;        ///> max. num. of function evaluations (0: unbounded)
+  double         inertia;        ///> inertia weight
+  double         cognitive;      ///> attraction to the personal best
+  double         social;         ///> attraction to the guide
+  double         maxVelocity;    ///> max. velocity relative to the bounds
+  bool           ring;           ///> whether the ring topology is used
+  bool           asynchronous;   ///> whether the asynchronous mode is used
+
+  unsigned int   n;              ///> dimension
+  unsigned int   P;              ///> number of particles
+  vector<double> x;              ///> positions (n x P)
+  vector<double> v;              ///> velocities (n x P)
+  vector<double> pbest;          ///> personal best positions (n x P)
+  vector<Best>   best;           ///> personal best values and neighborhood bests
+  vector<double> vmax;           ///> max. velocity per coordinate
+  volatile unsigned int gbest;   ///> particle of the global best
+  vector<double> r1,r2;          ///> random numbers of a generation
+  vector<EORVT>  offspring;      ///> moved particles of a generation
+  volatile unsigned long issued; ///> number of issued evaluations (asynchronous)
+  volatile unsigned long cursor; ///> round robin over the particles (asynchronous)
+  unsigned int   gen;            ///> number of generations
+
+};
+
+#endif
@@ -0,0 +1,80 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+/**
+ * \file  eoArchiveStep.h
+ *
+ * @date: Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+
+#ifndef _eoArchiveStep_h
+#define _eoArchiveStep_h
+
+#include <eo>
+
+#include "remo/src/eval/eoArchiveEval.h"
+
+
+/**
+ * \class eoArchiveStep
+ *
+ * Continuator passing the generation counter to the evaluation archive,
+ * s.t. archived points are tagged by their generation.
+ */
+template<class EOT>
+class eoArchiveStep : public eoContinue<EOT> {
+
+ public:
+
+  /**
+   * Cor.
+   *
+   * @param _archive archiving evaluation
+   */
+  eoArchiveStep(eoArchiveEval<EOT>& _archive) : archive(_archive),generations(0) { }
+
+  /// set the generation counter (resume)
+  void setGenerations(unsigned long _generations) {
+    generations = _generations;
+    archive.setStep(generations);
+  }
+
+  /**
+   * count the generation
+   * @return true
+   */
+  virtual bool operator()(const eoPop<EOT>& _pop) {
+    archive.setStep(++generations);
+    return true;
+  }
+
+  virtual std::string className(void) const {
+    return "eoArchiveStep";
+  }
+
+ protected:
+
+  eoArchiveEval<EOT>&  archive;      ///> archiving evaluation
+  unsigned long        generations;  ///> generation counter
+};
+
+#endif
@@ -0,0 +1,115 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+/**
+ * \file  eoCheckpointSaver.h
+ *
+ * @date: Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+
+#ifndef _eoCheckpointSaver_h
+#define _eoCheckpointSaver_h
+
+#include <string>
+#include <eo>
+
+#include "util/Checkpoint.h"
+
+
+/**
+ * \class eoCheckpointSaver
+ *
+ * Continuator writing a binary checkpoint (see util/Checkpoint.h) of the
+ * population, the evaluation counter, the generation counter and the global
+ * random number generator each every-th generation. The files are written
+ * in a background thread.
+ */
+template<class EOT>
+class eoCheckpointSaver : public eoContinue<EOT> {
+
+ public:
+
+  /**
+   * Cor.
+   *
+   * @param _counter  evaluation counter
+   * @param _file     checkpoint file
+   * @param _every    checkpoint each _every generations
+   */
+  eoCheckpointSaver(eoEvalFuncCounter<EOT>& _counter,const std::string& _file,unsigned int _every=10)
+    : counter(_counter),writer(_file),every(_every),generations(0) { }
+
+  /**
+   * set the generation counter (resume)
+   */
+  void setGenerations(unsigned long _generations) {
+    generations = _generations;
+  }
+
+  /**
+   * count the generation and write a checkpoint each every-th generation
+   */
+  virtual bool operator()(const eoPop<EOT>& _pop) {
+    generations++;
+    if(every > 0 && generations % every == 0)
+      save(_pop);
+    return true;
+  }
+
+  /**
+   * snapshot the state and hand it to the background writer
+   *
+   * @param _pop    population
+   * @param _flush  whether to wait until the file is written
+   */
+  void save(const eoPop<EOT>& _pop,bool _flush=false) {
+    Checkpoint cp;
+    cp.kind = Checkpoint::POPULATION;
+    cp.evaluations = counter.value();
+    cp.steps = generations;
+    cp.setRng(rng);
+    for(unsigned int i=0;i<_pop.size();i++)
+      cp.addSolution(_pop[i]);
+    cp.serialize(buffer);
+    writer.write(buffer);
+    if(_flush) writer.flush();
+  }
+
+  /// @return number of generations
+  unsigned long getGenerations() const {
+    return generations;
+  }
+
+  virtual std::string className(void) const {
+    return "eoCheckpointSaver";
+  }
+
+ protected:
+
+  eoEvalFuncCounter<EOT>&  counter;      ///> evaluation counter
+  CheckpointWriter         writer;       ///> background writer
+  std::vector<char>        buffer;       ///> serialized snapshot
+  unsigned int             every;        ///> checkpoint frequency
+  unsigned long            generations;  ///> generation counter
+};
+
+#endif
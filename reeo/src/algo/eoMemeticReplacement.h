@@ -0,0 +1,205 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+/**
+ * \file  eoMemeticReplacement.h
+ *
+ * @date: Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+
+#ifndef _eoMemeticReplacement_h
+#define _eoMemeticReplacement_h
+
+#include <vector>
+#include <algorithm>
+#include <eo>
+
+#include "remo/moRealTypes.h"
+
+
+/**
+ * \class eoMemeticReplacementBase
+ *
+ * Replacement decorator: after the wrapped replacement, the best numElites
+ * individuals of each every-th generation are refined in place by a short
+ * local search with at most budget function evaluations each, the budget
+ * is checked per evaluation (@see eoBoundedEvalFuncCounter).
+ * The refinements run concurrently on the worker pool.
+ */
+class eoMemeticReplacementBase : public eoReplacement<EORVT> {
+
+ public:
+
+  /**
+   * Cor.
+   *
+   * @param _eval          thread-safe evaluation function of the manager
+   * @param _numElites     number of refined individuals per generation
+   * @param _every         refinement each _every generations
+   * @param _budget        max. num. of function evaluations of a single refinement
+   * @param _numNeighbors  number of neighbors of the local search
+   * @param _radius        neighborhood boundary radius of the local search
+   * @param _parallel      whether the refinements run concurrently
+   */
+  eoMemeticReplacementBase(eoEvalFunc<EORVT>& _eval,
+			   unsigned int _numElites,
+			   unsigned int _every,
+			   unsigned int _budget,
+			   unsigned int _numNeighbors,
+			   double _radius,
+			   bool _parallel)
+    : eval(_eval),replace(0),counter(0),maxEval(0),
+    numElites(_numElites),every(_every),budget(_budget),
+    numNeighbors(_numNeighbors),radius(_radius),parallel(_parallel),
+    gen(0),numRefinements(0) { }
+
+  /// Destructor
+  virtual ~eoMemeticReplacementBase() { }
+
+  /**
+   * set the wrapped replacement
+   */
+  void setReplacement(eoReplacement<EORVT>& _replace) {
+    replace = &_replace;
+  }
+
+  /**
+   * set the global evaluation limit, the refinement budget is
+   * restricted s.t. the limit is respected
+   *
+   * @param _counter  evaluation counter of the manager
+   * @param _maxEval  max. num. of function evaluations
+   */
+  void setEvalLimit(eoEvalFuncCounter<EORVT>& _counter,unsigned long _maxEval) {
+    counter = &_counter;
+    maxEval = _maxEval;
+  }
+
+  /**
+   * replacement followed by the refinement of the elites
+   */
+  virtual void operator()(eoPop<EORVT>& _parents,eoPop<EORVT>& _offspring) {
+    (*replace)(_parents,_offspring);
+    gen++;
+    if(every > 0 && gen % every == 0)
+      refine(_parents);
+  }
+
+  /**
+   * @return number of performed local searches
+   */
+  unsigned long getNumRefinements() const {
+    return numRefinements;
+  }
+
+ protected:
+
+  /**
+   * refine the best individuals of a population
+   */
+  void refine(eoPop<EORVT>& _pop) {
+    int k = std::min<unsigned>(numElites,_pop.size());
+    if(k == 0) return;
+    unsigned long cap = budget;
+    if(counter != 0 && maxEval > 0) {
+      if(counter->value() >= maxEval) return;
+      cap = std::min<unsigned long>(cap,(maxEval - counter->value()) / k);
+      if(cap == 0) return;
+    }
+    if(k < (int) _pop.size()) _pop.nth_element(k);
+    // independent random streams for the concurrent local searches
+    std::vector<uint32_t> seeds(k);
+    for(int i=0;i<k;i++) seeds[i] = rng.rand();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,1) if(parallel)
+#endif
+    for(int i=0;i<k;i++)
+      refineOne(_pop[i],seeds[i],cap);
+    numRefinements += k;
+  }
+
+  /**
+   * refine a single individual
+   *
+   * @param _sol   individual
+   * @param _seed  seed of the random stream of the local search
+   * @param _cap   max. num. of function evaluations
+   */
+  virtual void refineOne(EORVT& _sol,uint32_t _seed,unsigned long _cap)=0;
+
+  eoEvalFunc<EORVT>&         eval;          ///> thread-safe evaluation of the manager
+  eoReplacement<EORVT>*      replace;       ///> wrapped replacement
+  eoEvalFuncCounter<EORVT>*  counter;       ///> evaluation counter of the manager
+  unsigned long              maxEval;       ///> global evaluation limit (0: unbounded)
+  unsigned int               numElites;     ///> number of refined individuals
+  unsigned int               every;         ///> refinement frequency in generations
+  unsigned int               budget;        ///> evaluations of a single refinement
+  unsigned int               numNeighbors;  ///> number of neighbors
+  double                     radius;        ///> neighborhood radius
+  bool                       parallel;      ///> whether refinements run concurrently
+  unsigned long              gen;           ///> generation counter
+  unsigned long              numRefinements;///> number of local searches
+};
+
+
+/**
+ * \class eoMemeticReplacement
+ *
+ * Memetic replacement with an arbitrary local search of moRealTypes.h.
+ * Local searches running concurrently should not use the global rng
+ * (e.g. SimulatedAnnealing), otherwise set _parallel to false.
+ */
+template<class LocalSearch>
+class eoMemeticReplacement : public eoMemeticReplacementBase {
+
+ public:
+
+  /**
+   * Cor. @see eoMemeticReplacementBase
+   */
+  eoMemeticReplacement(eoEvalFunc<EORVT>& _eval,
+		       unsigned int _numElites,
+		       unsigned int _every=1,
+		       unsigned int _budget=100,
+		       unsigned int _numNeighbors=20,
+		       double _radius=0.1,
+		       bool _parallel=true)
+    : eoMemeticReplacementBase(_eval,_numElites,_every,_budget,_numNeighbors,_radius,_parallel) { }
+
+ protected:
+
+  virtual void refineOne(EORVT& _sol,uint32_t _seed,unsigned long _cap) {
+    eoRng localRng(_seed);
+    // thread-safe for the concurrent evaluations of the local search, the cap
+    // is checked per evaluation (a neighborhood would overshoot the continuator)
+    BoundedGoalFuncCounter localEval(eval,_cap);
+    Neighborhood neighborhood(numNeighbors,radius,localRng);
+    NeighborEval neighborEval(localEval);
+    LocalSearch ls(neighborhood,localEval,neighborEval);
+    MaxNumEval maxeval(localEval,_cap);
+    ls.setContinuator(maxeval);
+    ls(_sol);
+  }
+
+};
+
+#endif
@@ -0,0 +1,71 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+/**
+ * \file  eoPooledReplacement.h
+ *
+ * @date: Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+
+#ifndef _eoPooledReplacement_h
+#define _eoPooledReplacement_h
+
+#include <eo>
+
+#include "remo/moRealTypes.h"
+#include "util/GenomePool.h"
+
+
+/**
+ * \class eoPooledReplacement
+ *
+ * Replacement decorator: the individuals left in the offspring by the
+ * wrapped replacement (e.g. the former parents of a generational
+ * replacement) are discarded by the algorithm, their genome buffers are
+ * returned to a GenomePool for the next generation.
+ */
+class eoPooledReplacement : public eoReplacement<EORVT> {
+
+ public:
+
+  /**
+   * Cor.
+   *
+   * @param _replace  wrapped replacement
+   * @param _pool     recycled genome buffers
+   */
+  eoPooledReplacement(eoReplacement<EORVT>& _replace,GenomePool& _pool)
+    : replace(_replace),pool(_pool) { }
+
+  virtual void operator()(eoPop<EORVT>& _parents,eoPop<EORVT>& _offspring) {
+    replace(_parents,_offspring);
+    pool.releaseAll(_offspring);
+    _offspring.clear();
+  }
+
+ protected:
+
+  eoReplacement<EORVT>&  replace;  ///> wrapped replacement
+  GenomePool&            pool;     ///> recycled genome buffers
+};
+
+#endif
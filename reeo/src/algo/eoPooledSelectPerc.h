@@ -0,0 +1,78 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+/**
+ * \file  eoPooledSelectPerc.h
+ *
+ * @date: Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+
+#ifndef _eoPooledSelectPerc_h
+#define _eoPooledSelectPerc_h
+
+#include <cmath>
+#include <eo>
+
+#include "remo/moRealTypes.h"
+#include "util/GenomePool.h"
+
+
+/**
+ * \class eoPooledSelectPerc
+ *
+ * Selection of a percentage of the population as eoSelectPerc, the copies
+ * of the selected parents are written into recycled genome buffers of a
+ * GenomePool instead of newly allocated ones.
+ */
+class eoPooledSelectPerc : public eoSelect<EORVT> {
+
+ public:
+
+  /**
+   * Cor.
+   *
+   * @param _select  selection of a single individual
+   * @param _pool    recycled genome buffers
+   * @param _rate    num. of selected individuals w.r.t. the population size
+   */
+  eoPooledSelectPerc(eoSelectOne<EORVT>& _select,GenomePool& _pool,float _rate=1.0)
+    : select(_select),pool(_pool),rate(_rate) { }
+
+  virtual void operator()(const eoPop<EORVT>& _source,eoPop<EORVT>& _dest) {
+    unsigned int target = (unsigned int) std::floor(rate * _source.size());
+    _dest.resize(target);
+    select.setup(_source);
+    for(unsigned int i=0;i<target;i++) {
+      const EORVT& parent = select(_source);
+      pool.acquire(_dest[i],parent.size());
+      _dest[i] = parent;
+    }
+  }
+
+ protected:
+
+  eoSelectOne<EORVT>&  select;  ///> selection of a single individual
+  GenomePool&          pool;    ///> recycled genome buffers
+  float                rate;    ///> selection rate (float as in eoSelectPerc)
+};
+
+#endif
@@ -0,0 +1,146 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+/**
+ * \file  eoSurrogateTransform.h
+ *
+ * @date: Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+
+#ifndef _eoSurrogateTransform_h
+#define _eoSurrogateTransform_h
+
+#include <vector>
+#include <algorithm>
+#include <eo>
+
+#include "remo/moRealTypes.h"
+#include "util/GenomePool.h"
+
+
+/**
+ * \class eoSurrogateTransform
+ *
+ * Transform decorator for surrogate-assisted pre-selection of offspring:
+ * the selection produces more offspring than needed, after the wrapped
+ * variation the offspring are ranked by a surrogate model (unchanged copies of
+ * parents by their true fitness) and only numOffspring most promising ones
+ * are kept for the true evaluation.
+ * Before the model is ready the surplus offspring are dropped at random.
+ * The kept offspring are moved by swapping, the genome buffers of the
+ * rejected ones are recycled by an optional GenomePool.
+ */
+class eoSurrogateTransform : public eoTransform<EORVT> {
+
+ public:
+
+  /**
+   * Cor.
+   *
+   * @param _transform     wrapped variation operators
+   * @param _model         surrogate model
+   * @param _numOffspring  number of offspring kept for the evaluation
+   * @param _pool          pool taking the genomes of the rejected offspring (0: none)
+   */
+  eoSurrogateTransform(eoTransform<EORVT>& _transform,const moSurrogate& _model,unsigned int _numOffspring,GenomePool* _pool=0)
+    : transform(_transform),model(_model),numOffspring(_numOffspring),numRejected(0),pool(_pool) { }
+
+  /**
+   * variation followed by the pre-selection
+   */
+  virtual void operator()(eoPop<EORVT>& _offspring) {
+    transform(_offspring);
+    unsigned int keep = numOffspring;
+    if(keep == 0 || keep >= _offspring.size()) return;
+    unsigned int size = _offspring.size();
+    f.resize(size);
+    order.resize(size);
+    bool ready = model.ready();
+    for(unsigned int i=0;i<size;i++) {
+      order[i] = i;
+      if(!_offspring[i].invalid()) 
+	f[i] = _offspring[i].fitness();
+      else 
+	f[i] = ready ? model.predict(_offspring[i]) : rng.uniform();
+    }
+    if(!ready) {
+      // only the surplus of the invalid offspring is random
+      for(unsigned int i=0;i<size;i++) 
+	if(!_offspring[i].invalid()) f[i] = -1.0;
+    }
+    std::partial_sort(order.begin(),order.begin()+keep,order.end(),Compare(f));
+    // _offspring[i] = _offspring[order[i]] by swapping, position: current
+    // index of an offspring, index: offspring at a position
+    position.resize(size);
+    index.resize(size);
+    for(unsigned int i=0;i<size;i++) position[i] = index[i] = i;
+    for(unsigned int i=0;i<keep;i++) {
+      int p = position[order[i]];
+      if(p == (int) i) continue;
+      swap(_offspring[i],_offspring[p]);
+      index[p] = index[i];
+      position[index[p]] = p;
+      index[i] = order[i];
+      position[order[i]] = i;
+    }
+    if(pool != 0) pool->releaseAll(_offspring,keep);
+    _offspring.resize(keep);
+    numRejected += size - keep;
+  }
+
+  /**
+   * @return number of offspring discarded without evaluation
+   */
+  unsigned long getNumRejected() const {
+    return numRejected;
+  }
+
+ protected:
+
+  /// ascending order of (predicted) objective values
+  struct Compare {
+    Compare(const std::vector<double>& _f) : f(_f) { }
+    bool operator()(int _a,int _b) const { return f[_a] < f[_b]; }
+    const std::vector<double>& f;
+  };
+
+  /// swap genomes and fitness of two individuals without copying the genomes
+  static void swap(EORVT& _a,EORVT& _b) {
+    bool valid = !_a.invalid();
+    Fitness fitness = valid ? _a.fitness() : Fitness();
+    if(_b.invalid()) _a.invalidate(); else _a.fitness(_b.fitness());
+    if(valid) _b.fitness(fitness); else _b.invalidate();
+    static_cast<std::vector<double>&>(_a).swap(_b);
+  }
+
+  eoTransform<EORVT>&  transform;    ///> wrapped variation operators
+  const moSurrogate&   model;        ///> surrogate model
+  unsigned int         numOffspring; ///> number of evaluated offspring
+  unsigned long        numRejected;  ///> number of discarded offspring
+  GenomePool*          pool;         ///> recycled genome buffers (0: none)
+  std::vector<double>  f;            ///> (predicted) objective values
+  std::vector<int>     order;        ///> offspring by ascending values
+  std::vector<int>     position;     ///> current position of an offspring
+  std::vector<int>     index;        ///> offspring at a position
+};
+
+#endif
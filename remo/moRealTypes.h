@@ -57,8 +57,30 @@ typedef eoReal<Fitness> EORVT;
 //** header for functional evaluation 
 
 //typedef eoEvalFuncPtr<EORVT,double,const std::vector<double>&> GoalFunc;
+// header for a persistent cache of objective values 
+#include "src/eval/eoCacheEval.h"
+/** evaluation consulting a cache */ 
+typedef eoCacheEval<EORVT>  CacheEval; 
+
+// header for an archive of all evaluated points 
+#include "src/eval/eoArchiveEval.h"
+/** evaluation appending to an archive */ 
+typedef eoArchiveEval<EORVT>  ArchiveEval; 
+
+// header for a thread-safe counter of evaluations 
+#include "src/eval/eoParallelEvalFuncCounter.h"
 /** counter of objective function evaluation */ 
-typedef eoEvalFuncCounter<EORVT>  GoalFuncCounter;   
+typedef eoParallelEvalFuncCounter<EORVT>  GoalFuncCounter;   
+
+// header for a thread-safe counter of evaluations with a budget 
+#include "src/eval/eoBoundedEvalFuncCounter.h"
+/** counter of objective function evaluation bounded per evaluation */ 
+typedef eoBoundedEvalFuncCounter<EORVT>  BoundedGoalFuncCounter;   
+
+// header for surrogate models trained on the true evaluations 
+#include "src/eval/eoSurrogateEval.h"
+/** evaluation training a surrogate model */ 
+typedef eoSurrogateEval<EORVT>  SurrogateEval; 
     
 /********************************************************
  *
@@ -76,12 +98,54 @@ typedef moRealBoundaryNeighbor<Fitness> Neighbor;
 #include "src/eval/moRealBoundaryNeighborhood.h"
 /** Neighborhood */ 
 typedef moRealBoundaryNeighborhood<Fitness> Neighborhood;
+/** Repair of the neighbors leaving the bounds (a policy of the neighborhood) */ 
+typedef moRealBoundRepair BoundRepair;
+
+// header for a neighborhood with a radius adapted by a success rule 
+#include "src/eval/moRealAdaptiveNeighborhood.h"
+/** Adaptive neighborhood */ 
+typedef moRealAdaptiveNeighborhood<Fitness> AdaptiveNeighborhood;
 
 // header for incremental functional evaluation 
 #include "eval/moFullEvalByModif.h"
 /** */ 
 typedef moFullEvalByModif<Neighbor> NeighborEval;
 
+// header for the bounded evaluation of neighbors by hill climbers 
+// (moBoundedEvalByModif<Neighbor,eoObjFunc>)
+#include "src/eval/moBoundedEvalByModif.h"
+
+// header for the neighbor evaluation reporting to the success rule of the neighborhood 
+#include "src/eval/moSuccessRateEval.h"
+/** */ 
+typedef moSuccessRateEval<Neighbor,AdaptiveNeighborhood> SuccessRateEval;
+
+// header for neighbors of a random subspace in very high dimensions 
+#include "src/eval/moRealSubspaceNeighbor.h"
+/** Neighbor moving a subspace */ 
+typedef moRealSubspaceNeighbor<Fitness> SubspaceNeighbor;
+
+// header for the neighborhood of random subspaces 
+#include "src/eval/moRealSubspaceNeighborhood.h"
+/** Neighborhood of random subspaces */ 
+typedef moRealSubspaceNeighborhood<Fitness> SubspaceNeighborhood;
+
+// header for the incremental evaluation of subspace neighbors 
+// (moIncrementalEval<SubspaceNeighbor,eoObjFunc>)
+#include "src/eval/moIncrementalEval.h"
+
+// header for neighbors regenerated from a key 
+#include "src/eval/moRealSeedNeighbor.h"
+/** Neighbor stored as a key (stream id, counter) */ 
+typedef moRealSeedNeighbor<Fitness> SeedNeighbor;
+
+// header for the neighborhood of seed neighbors 
+#include "src/eval/moRealSeedNeighborhood.h"
+/** Neighborhood of seed neighbors */ 
+typedef moRealSeedNeighborhood<Fitness> SeedNeighborhood;
+/** evaluation of seed neighbors */ 
+typedef moFullEvalByModif<SeedNeighbor> SeedNeighborEval;
+
 
 /********************************************************
  *
@@ -99,16 +163,42 @@ typedef moFullEvalByModif<Neighbor> NeighborEval;
 #include "src/algo/moTSUnified.h" 
 #include "algo/moRandomNeutralWalk.h" // does not improve fitness
 #include "algo/moMetropolisHasting.h" // does not improve fitness 
+// gradient and residual interface of the objective functions (RSRRMVOF)
+#include "objfunc/eoObjFunc.h"
+#include "src/algo/moQuasiNewton.h" 
+#include "src/algo/moSPSA.h" 
+#include "src/algo/moLevenbergMarquardt.h" 
+#include "src/algo/moPatternSearch.h" 
+#include "src/algo/moNelderMead.h" 
+#include "src/algo/moTrustRegion.h" 
 
 /** SimpleHillClimbing */ 
 typedef moSimpleHC<Neighbor>    SimpleHillClimbing;
 /** First improvment of HC */ 
 typedef moFirstImprHC<Neighbor> FirstImprHillClimbing;
+/** First improvement HC in random subspaces (@see SubspaceNeighborhood) */ 
+typedef moFirstImprHC<SubspaceNeighbor> SubspaceHillClimbing;
+/** HC with seed neighbors (@see SeedNeighborhood) */ 
+typedef moSimpleHC<SeedNeighbor>   SeedHillClimbing;
+/** Tabu Search with seed neighbors, the tabu list stores keys (@see SeedNeighborhood::setNumStreams) */ 
+typedef moTSUnified<SeedNeighbor>  SeedTabuSearch;
 /** Simulated Annealing*/
 typedef moSA<Neighbor>          SimulatedAnnealing;
 /** Tabu Search*/ 
 //typedef moTS<Neighbor>          TabuSearch;
 typedef moTSUnified<Neighbor>   TabuSearch;
+/** Quasi-Newton (BFGS, L-BFGS) with finite difference or analytic gradients */ 
+typedef moQuasiNewton<Neighbor,RSRRMVOF> QuasiNewton;
+/** Simultaneous perturbation stochastic approximation */ 
+typedef moSPSA<Neighbor>        SPSA;
+/** Levenberg-Marquardt with finite difference and Broyden Jacobians */ 
+typedef moLevenbergMarquardt<Neighbor,RSRRMVOF> LevenbergMarquardt;
+/** Pattern search (Hooke-Jeeves / GPS) with concurrent polling */ 
+typedef moPatternSearch<Neighbor> PatternSearch;
+/** Nelder-Mead simplex method with concurrent vertex evaluation */ 
+typedef moNelderMead<Neighbor>  NelderMead;
+/** Derivative-free trust region method with quadratic interpolation models */ 
+typedef moTrustRegion<Neighbor> TrustRegion;
 
 
 /********************************************************
@@ -133,11 +223,24 @@ typedef moTSUnified<Neighbor>   TabuSearch;
 #include "continuator/moFullEvalContinuator.h"
 /** maximum number of iteration */ 
 typedef moIterContinuator<Neighbor>      MaxNumIter;
+// header for the iterations counted in total over a resumed run 
+#include "src/continuator/moTotalIterContinuator.h"
+/** maximum number of iteration in total */ 
+typedef moTotalIterContinuator<Neighbor> TotalNumIter;
 /** stopping criteria */ 
 typedef moCombinedContinuator<Neighbor>  StoppingCriteria;
 /** maximum number of functions evaluation */ 
 typedef moFullEvalContinuator<Neighbor>  MaxNumEval; 
 
+// header for binary checkpoints of a local search 
+#include "src/continuator/moCheckpointSaver.h"
+/** periodic checkpoint */ 
+typedef moCheckpointSaver<Neighbor>      CheckpointSaver; 
+// header for tagging archived points by iteration 
+#include "src/continuator/moArchiveStep.h"
+/** iteration counter of the archive */ 
+typedef moArchiveStep<Neighbor>          ArchiveStep; 
+
 // see also
 // moBestNoImproveContinuator
 // moTimeContinuator
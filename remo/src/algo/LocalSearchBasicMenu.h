@@ -48,6 +48,9 @@ using namespace std;
 // include for solution initialization
 #include "util/Utilities.h"
 
+// objective function given by the --formula flag
+#include "objfunc/expression/ExpressionObj.h"
+
 template<class LocalSearch, class eoObjFunc> 
   class LocalSearchBasicMenu {
 
@@ -138,6 +141,13 @@ template<class LocalSearch, class eoObjFunc>
     const char* TSMENU   = "Tabu Search";
     const char* SCMENU   = "Stopping Criteria";
     const char* SAMENU   = "Simulated Annealing";
+    const char* QNMENU   = "Quasi Newton";
+    const char* SPSAMENU = "SPSA";
+    const char* LMMENU   = "Levenberg Marquardt";
+    const char* PSMENU   = "Pattern Search";
+    const char* NMMENU   = "Nelder Mead";
+    const char* TRMENU   = "Trust Region";
+    const char* SURMENU  = "Surrogate";
 
     // execute the local search
     bool execute  = processFlag<bool>(false,"execute","Execute the local search",'E');
@@ -148,12 +158,20 @@ template<class LocalSearch, class eoObjFunc>
     // problem size
     unsigned N = processFlag<unsigned>(unsigned(10),"vecSize","The number of variables ",'n',false,FUNCMENU);
     cout << "N : " << N << "\n"; 
+
+    // formula of ExpressionObj, set before the objective function is constructed 
+    string formula = processFlag<string>(string(""),"formula","objective function over x[i] and n, e.g. sum(i,0,n-1,x[i]^2) (ExpressionObj)",'\0',false,FUNCMENU);
+    if(!formula.empty()) {
+      if(typeid(eoObjFunc) != typeid(ExpressionObj)) 
+	std::cerr << "formula : only used by ExpressionObj\n";
+      ExpressionObj::configure(formula);
+    }
     
     // boundaries box 
     eoValueParam<eoRealVectorBounds> boundsParam(
 			 eoRealVectorBounds(N, -100, 100),
 			 "initBounds",
-			 "Bounds for initialization (MUST be bounded)",
+			 "Bounds for initialization and of the neighbors (MUST be bounded)",
 			 'B');
     parser.processParam(boundsParam, FUNCMENU);
     
@@ -162,6 +180,17 @@ template<class LocalSearch, class eoObjFunc>
 
     double boundaryRadius = processFlag<double>(0.1,"boundaryradius", "The radious of the neighborhood",'R',false,LSMENU);
 
+    bool adaptiveRadius = processFlag<bool>(false,"adaptiveRadius", "adapt the radius of the neighborhood by a success rule",'\0',false,LSMENU);
+    double successRate = processFlag<double>(0.2,"successRate", "target rate of improving neighbors of the adaptive radius (0.2: 1/5th rule)",'\0',false,LSMENU);
+    double radiusFactor = processFlag<double>(0.85,"radiusFactor", "shrinking factor of the adaptive radius",'\0',false,LSMENU);
+    bool scaleRadius = processFlag<bool>(false,"scaleRadius", "the radius is relative to the ranges of the bounds",'\0',false,LSMENU);
+
+    string sampling = processFlag<string>(string("Uniform"),"sampling", "Sampling of the neighbors: Uniform or Sobol",'\0',false,LSMENU);
+
+    string boundRepair = processFlag<string>(string("None"),"boundRepair", "Repair of neighbors leaving the bounds: None, Clip, Reflect or Resample",'\0',false,LSMENU);
+
+    bool boundedEval = processFlag<bool>(false,"boundedEval", "stop evaluations of neighbors which cannot improve (hill climbing)",'\0',false,LSMENU);
+
     uint32_t maxiter = processFlag<uint32_t>(1000,"maxiter","max. number of iterations",'i',false,SCMENU);
 
     uint32_t maxeval = processFlag<uint32_t>(10000,"maxeval","max. number of function's evaluations",'e',false,SCMENU);
@@ -169,6 +198,14 @@ template<class LocalSearch, class eoObjFunc>
     string str_status = _filename + ".status"; 
     string statusParam = processFlag<string>(str_status,"status","Status file",'F',false,"Persistence");
 
+    string checkpointFile = processFlag<string>(string(""),"checkpoint","Binary checkpoint file (empty: none)",'\0',false,"Persistence");
+    uint32_t checkpointEvery = processFlag<uint32_t>(100,"checkpointEvery","checkpoint each checkpointEvery iterations",'\0',false,"Persistence");
+    string resumeFile = processFlag<string>(string(""),"resume","Resume the run from a checkpoint file, e.g. the one of --checkpoint (empty: none)",'\0',false,"Persistence");
+    string archiveFile = processFlag<string>(string(""),"archive","Memory mapped archive of all evaluated points (empty: none)",'\0',false,"Persistence");
+    string cacheFile = processFlag<string>(string(""),"cache","Persistent cache of objective values shared by runs (empty: none)",'\0',false,"Persistence");
+    uint32_t cacheSize = processFlag<uint32_t>(1048576,"cacheSize","max. number of points in a new cache",'\0',false,"Persistence");
+    string cacheKey = processFlag<string>(string(""),"cacheKey","identity of the objective function in the cache (empty: class name, formula or dataset)",'\0',false,"Persistence");
+
     // @todo boundaryRadius
     /*  
      stopping conditions:
@@ -223,9 +260,133 @@ template<class LocalSearch, class eoObjFunc>
       ((LocalSearchManagerSA<eoObjFunc>*) manager)->setSpan(span);
       ((LocalSearchManagerSA<eoObjFunc>*) manager)->setFinalTemp(finalT);
     }
+    else if(typeid(LocalSearch) == typeid(QuasiNewton)) {
+      manager = (BaseLocalSearchManager<LocalSearch,eoObjFunc> *) new LocalSearchManagerQN<eoObjFunc>(lowBounds,uppBounds,numNeighbors,boundaryRadius,maxiter);
+      unsigned memory = processFlag<unsigned>(0, "memory", "num. of correction pairs of L-BFGS (0: BFGS)", '\0',false,QNMENU);
+      bool central = processFlag<bool>(false, "central", "central instead of forward differences", '\0',false,QNMENU);
+      double fdStep = processFlag<double>(0.0, "fdStep", "relative finite difference step (0: default)", '\0',false,QNMENU);
+      double gradTol = processFlag<double>(1e-8, "gradTol", "tolerance of the gradient norm", '\0',false,QNMENU);
+      bool fdGradient = processFlag<bool>(false, "fdGradient", "finite differences even if the objective function provides gradients", '\0',false,QNMENU);
+      ((LocalSearchManagerQN<eoObjFunc>*) manager)->setMemory(memory);
+      ((LocalSearchManagerQN<eoObjFunc>*) manager)->setCentralDifferences(central);
+      ((LocalSearchManagerQN<eoObjFunc>*) manager)->setFDStep(fdStep);
+      ((LocalSearchManagerQN<eoObjFunc>*) manager)->setGradTol(gradTol);
+      ((LocalSearchManagerQN<eoObjFunc>*) manager)->setAnalyticGradient(!fdGradient);
+    }
+    else if(typeid(LocalSearch) == typeid(SPSA)) {
+      manager = (BaseLocalSearchManager<LocalSearch,eoObjFunc> *) new LocalSearchManagerSPSA<eoObjFunc>(lowBounds,uppBounds,numNeighbors,boundaryRadius,maxiter);
+      unsigned numAverages = processFlag<unsigned>(1, "spsaAverages", "num. of averaged gradient estimates per iteration", '\0',false,SPSAMENU);
+      double a = processFlag<double>(0.1, "spsaA", "step gain a of a_k = a / (k + 1 + A)^alpha", '\0',false,SPSAMENU);
+      double c = processFlag<double>(0.1, "spsaC", "perturbation gain c of c_k = c / (k + 1)^gamma", '\0',false,SPSAMENU);
+      double A = processFlag<double>(10.0, "spsaStability", "stability constant A of the step gain", '\0',false,SPSAMENU);
+      double alpha = processFlag<double>(0.602, "spsaAlpha", "decay exponent alpha of the step gain", '\0',false,SPSAMENU);
+      double gamma = processFlag<double>(0.101, "spsaGamma", "decay exponent gamma of the perturbation gain", '\0',false,SPSAMENU);
+      bool evalIterate = processFlag<bool>(false, "spsaEvalIterate", "evaluate each new iterate (2 * spsaAverages + 1 evaluations per iteration)", '\0',false,SPSAMENU);
+      ((LocalSearchManagerSPSA<eoObjFunc>*) manager)->setNumAverages(numAverages);
+      ((LocalSearchManagerSPSA<eoObjFunc>*) manager)->setGains(a,c,A,alpha,gamma);
+      ((LocalSearchManagerSPSA<eoObjFunc>*) manager)->setEvalIterate(evalIterate);
+    }
+    else if(typeid(LocalSearch) == typeid(LevenbergMarquardt)) {
+      manager = (BaseLocalSearchManager<LocalSearch,eoObjFunc> *) new LocalSearchManagerLM<eoObjFunc>(lowBounds,uppBounds,numNeighbors,boundaryRadius,maxiter);
+      unsigned refresh = processFlag<unsigned>(10, "lmRefresh", "num. of iterations between finite difference Jacobians (1: no Broyden updates)", '\0',false,LMMENU);
+      double fdStep = processFlag<double>(0.0, "lmFdStep", "relative finite difference step (0: default)", '\0',false,LMMENU);
+      double gradTol = processFlag<double>(1e-10, "lmGradTol", "tolerance of the gradient norm", '\0',false,LMMENU);
+      double damping = processFlag<double>(1e-3, "lmDamping", "initial damping relative to max. diagonal of J^T J", '\0',false,LMMENU);
+      ((LocalSearchManagerLM<eoObjFunc>*) manager)->setRefresh(refresh);
+      ((LocalSearchManagerLM<eoObjFunc>*) manager)->setFDStep(fdStep);
+      ((LocalSearchManagerLM<eoObjFunc>*) manager)->setGradTol(gradTol);
+      ((LocalSearchManagerLM<eoObjFunc>*) manager)->setInitialDamping(damping);
+    }
+    else if(typeid(LocalSearch) == typeid(PatternSearch)) {
+      manager = (BaseLocalSearchManager<LocalSearch,eoObjFunc> *) new LocalSearchManagerPS<eoObjFunc>(lowBounds,uppBounds,numNeighbors,boundaryRadius,maxiter);
+      double step = processFlag<double>(boundaryRadius, "psStep", "initial step of the poll", '\0',false,PSMENU);
+      double minStep = processFlag<double>(1e-8, "psMinStep", "minimal step for stopping", '\0',false,PSMENU);
+      double expansion = processFlag<double>(2.0, "psExpansion", "expansion factor of the step on success", '\0',false,PSMENU);
+      double contraction = processFlag<double>(0.5, "psContraction", "contraction factor of the step on failure", '\0',false,PSMENU);
+      string pollSet = processFlag<string>(string("compass"), "psPollSet", "poll directions: compass (2n) or minimal (n+1)", '\0',false,PSMENU);
+      bool bestPoll = processFlag<bool>(false, "psBestPoll", "best poll point instead of the first improving one", '\0',false,PSMENU);
+      bool orderCache = processFlag<bool>(false, "psOrderCache", "poll successful directions first", '\0',false,PSMENU);
+      ((LocalSearchManagerPS<eoObjFunc>*) manager)->setSteps(step,minStep);
+      ((LocalSearchManagerPS<eoObjFunc>*) manager)->setFactors(expansion,contraction);
+      ((LocalSearchManagerPS<eoObjFunc>*) manager)->setMinimalPollSet(!pollSet.compare("minimal"));
+      ((LocalSearchManagerPS<eoObjFunc>*) manager)->setBestPoll(bestPoll);
+      ((LocalSearchManagerPS<eoObjFunc>*) manager)->setOrderCache(orderCache);
+    }
+    else if(typeid(LocalSearch) == typeid(NelderMead)) {
+      manager = (BaseLocalSearchManager<LocalSearch,eoObjFunc> *) new LocalSearchManagerNM<eoObjFunc>(lowBounds,uppBounds,numNeighbors,boundaryRadius,maxiter);
+      double step = processFlag<double>(0.1, "nmStep", "edge length of the initial simplex relative to the bounds", '\0',false,NMMENU);
+      unsigned numParallel = processFlag<unsigned>(1, "nmParallel", "num. of worst vertices replaced concurrently per iteration", '\0',false,NMMENU);
+      bool speculative = processFlag<bool>(false, "nmSpeculative", "evaluate reflection, expansion and contractions concurrently", '\0',false,NMMENU);
+      bool adaptive = processFlag<bool>(false, "nmAdaptive", "coefficients adapted to the dimension", '\0',false,NMMENU);
+      double xTol = processFlag<double>(1e-8, "nmXTol", "tolerance of the simplex size relative to the bounds", '\0',false,NMMENU);
+      double fTol = processFlag<double>(1e-12, "nmFTol", "tolerance of the spread of the objective values", '\0',false,NMMENU);
+      ((LocalSearchManagerNM<eoObjFunc>*) manager)->setStep(step);
+      ((LocalSearchManagerNM<eoObjFunc>*) manager)->setNumParallel(numParallel);
+      ((LocalSearchManagerNM<eoObjFunc>*) manager)->setSpeculative(speculative);
+      ((LocalSearchManagerNM<eoObjFunc>*) manager)->setAdaptive(adaptive);
+      ((LocalSearchManagerNM<eoObjFunc>*) manager)->setTolerances(xTol,fTol);
+    }
+    else if(typeid(LocalSearch) == typeid(TrustRegion)) {
+      manager = (BaseLocalSearchManager<LocalSearch,eoObjFunc> *) new LocalSearchManagerTR<eoObjFunc>(lowBounds,uppBounds,numNeighbors,boundaryRadius,maxiter);
+      double initRadius = processFlag<double>(0.1, "trInitRadius", "initial trust region radius relative to the bounds", '\0',false,TRMENU);
+      double endRadius = processFlag<double>(1e-8, "trEndRadius", "final trust region radius relative to the bounds", '\0',false,TRMENU);
+      unsigned numGeometry = processFlag<unsigned>(1, "trGeometry", "max. num. of geometry improving points evaluated concurrently", '\0',false,TRMENU);
+      ((LocalSearchManagerTR<eoObjFunc>*) manager)->setRadii(initRadius,endRadius);
+      ((LocalSearchManagerTR<eoObjFunc>*) manager)->setNumGeometry(numGeometry);
+    }
     else {
       manager = new LocalSearchManager<LocalSearch,eoObjFunc>(lowBounds,uppBounds,numNeighbors,boundaryRadius);
     }
+
+    {
+      string surrogate = processFlag<string>(string("None"), "surrogate", "Pre-screening of neighbors: None, RBF or Quadratic", '\0',false,SURMENU);
+      if(surrogate.compare("None")) {
+	double fraction = processFlag<double>(0.25, "surrogateFraction", "fraction of the neighbors which is evaluated", '\0',false,SURMENU);
+	if(!surrogate.compare("RBF")) {
+	  unsigned window = processFlag<unsigned>(200, "surrogateWindow", "num. of recent points of the RBF model", '\0',false,SURMENU);
+	  manager->setSurrogate(new moRBFSurrogate(window),fraction);
+	} else if(!surrogate.compare("Quadratic")) {
+	  double forgetting = processFlag<double>(0.99, "surrogateForgetting", "forgetting factor of the quadratic model", '\0',false,SURMENU);
+	  manager->setSurrogate(new moQuadraticSurrogate(forgetting),fraction);
+	} else 
+	  std::cerr << "surrogate : None, RBF or Quadratic\n";
+      }
+    }
+
+    if(!checkpointFile.empty()) 
+      manager->setCheckpoint(checkpointFile,checkpointEvery);
+    if(!resumeFile.empty()) 
+      manager->resume(resumeFile);
+
+    if(boundedEval) 
+      manager->setBoundedEval(true);
+
+    if(!sampling.compare("Sobol")) 
+      manager->setSampler(new moRealSobolSampler());
+    else if(sampling.compare("Uniform")) 
+      std::cerr << "sampling : Uniform or Sobol\n";
+
+    if(adaptiveRadius) 
+      manager->setAdaptiveRadius(successRate,radiusFactor);
+    if(scaleRadius) {
+      vector<double> ranges(lowBounds.size());
+      for(unsigned i=0;i<ranges.size();i++) ranges[i] = uppBounds[i] - lowBounds[i];
+      manager->setRadiusScale(ranges);
+    }
+
+    if(!boundRepair.compare("Clip")) 
+      manager->setBoundRepair(BoundRepair::CLIP);
+    else if(!boundRepair.compare("Reflect")) 
+      manager->setBoundRepair(BoundRepair::REFLECT);
+    else if(!boundRepair.compare("Resample")) 
+      manager->setBoundRepair(BoundRepair::RESAMPLE);
+    else if(boundRepair.compare("None")) 
+      std::cerr << "boundRepair : None, Clip, Reflect or Resample\n";
+
+    if(!archiveFile.empty()) 
+      manager->setArchive(archiveFile);
+    if(!cacheFile.empty()) 
+      manager->setCache(cacheFile,cacheSize,cacheKey);
     
     if (parser.userNeedsHelp()) {
       parser.printHelp(cout);
@@ -67,7 +67,7 @@ public:
    * @param _maxiter maximum number of iteration
    */ 
  BaseLocalSearchManager(const EORVT& _initial,uint32_t _numNeighbors,double _boundaryRadius,unsigned int _maxiter=getMaxUnsignedInt()) 
-   : ls(0),solution(_initial),mainEval(),eval(mainEval),neighborEval(eval),neighborhood(_numNeighbors,_boundaryRadius),initialized(false),maxiter(_maxiter),sc(maxiter),maxeval(0) { } 
+   : ls(0),solution(_initial),mainEval(),cacheEval(mainEval),archiveEval(cacheEval),eval(archiveEval),surrogateEval(eval),boundedNeighborEval(surrogateEval,mainEval,eval),neighborEval(boundedNeighborEval,neighborhood),neighborhood(_numNeighbors,_boundaryRadius),initialized(false),maxiter(_maxiter),sc(maxiter),maxeval(0),surrogate(0),sampler(0),checkpoint(0),resumed(false),resumedIterations(0),archiveStep(archiveEval),boundedEval(false) { } 
 
 
  /**
@@ -80,8 +80,11 @@ public:
    * @param _maxiter maximum number of iteration
    */ 
  BaseLocalSearchManager(const vector<double>& _lowerBound,const vector<double>& _upperBound,uint32_t _numNeighbors,double _boundaryRadius,unsigned int _maxiter=getMaxUnsignedInt()) 
-   : ls(0),mainEval(),eval(mainEval),neighborEval(eval),neighborhood(_numNeighbors,_boundaryRadius),initialized(false),maxiter(_maxiter),sc(maxiter),maxeval(0) { 
+   : ls(0),mainEval(),cacheEval(mainEval),archiveEval(cacheEval),eval(archiveEval),surrogateEval(eval),boundedNeighborEval(surrogateEval,mainEval,eval),neighborEval(boundedNeighborEval,neighborhood),neighborhood(_numNeighbors,_boundaryRadius),initialized(false),maxiter(_maxiter),sc(maxiter),maxeval(0),surrogate(0),sampler(0),checkpoint(0),resumed(false),resumedIterations(0),archiveStep(archiveEval),boundedEval(false) { 
     Utilities::getRandomSolution(solution,_lowerBound,_upperBound);
+    // the bounds only confine the neighbors once a repair is chosen (setBoundRepair())
+    boundRepair.setBounds(_lowerBound,_upperBound);
+    neighborhood.setRepair(&boundRepair);
 } 
 
 
@@ -91,6 +94,9 @@ public:
    try {
       delete ls;
       delete maxeval;
+      delete surrogate;
+      delete sampler;
+      delete checkpoint;
     }
     catch (int e) {
       std::cerr << "exception at Destructor of BaseLocalSearchManager : Nr. " << e << std::endl;
@@ -112,25 +118,215 @@ public:
     _os << "\n" << ls->className() << " solution : \n";
     solution.printOn(_os);
     _os << "\n obj func cntr : " << eval.value() << std::endl;
+    if(surrogate != 0) 
+      _os << " candidates rejected by " << surrogate->className() << " : " << screening.getNumRejected() << std::endl;
+    if(cacheEval.getNumHits() > 0) 
+      _os << " evaluations taken from the cache : " << cacheEval.getNumHits() << std::endl;
+    if(boundedNeighborEval.isBounded()) 
+      _os << " neighbor evaluations stopped early : " << boundedNeighborEval.getNumAborted() << std::endl;
+    if(boundRepair.getNumRepaired() > 0) 
+      _os << " infeasible neighbors repaired : " << boundRepair.getNumRepaired() << std::endl;
+    if(neighborhood.getNumObserved() > 0) 
+      _os << " neighborhood radius : " << neighborhood.getRadius() << " (improving neighbors " << neighborhood.getNumImproving() << " of " << neighborhood.getNumObserved() << ")" << std::endl;
    }
 
+  /**
+   * adapt the neighborhood radius by a success rule (@see moRealAdaptiveNeighborhood::setAdaptive)
+   * 
+   * @param _target  target success rate, 0.2: 1/5th rule 
+   * @param _factor  shrinking factor of the radius 
+   * @param _window  num. of evaluated neighbors between adaptations (0: num. of neighbors)
+   */
+  void setAdaptiveRadius(double _target=0.2,double _factor=0.85,unsigned _window=0) {
+    neighborhood.setAdaptive(_target,_factor,_window);
+  }
+
+  /**
+   * sample the offsets of the neighbors, the manager takes the ownership 
+   * 
+   * @param _sampler  e.g. new moRealSobolSampler() (0: pseudo random)
+   */
+  void setSampler(moRealSampler* _sampler) {
+    delete sampler; 
+    sampler = _sampler; 
+    neighborhood.setSampler(sampler);
+  }
+
+  /**
+   * scale the neighborhood radius per coordinate 
+   * 
+   * @param _scale  scaling factors, e.g. the ranges of the variables 
+   */
+  void setRadiusScale(const vector<double>& _scale) {
+    neighborhood.setScale(_scale);
+  }
+
+  /**
+   * keep the neighbors within bounds, they are repaired before evaluation. 
+   * The constructor with bounds sets them without repair (NONE), s.t. the 
+   * search is only confined by an explicit call of setBounds() or 
+   * setBoundRepair(). 
+   * 
+   * @param _lowerBound  lower bounds
+   * @param _upperBound  upper bounds
+   * @param _repair      BoundRepair::CLIP, REFLECT, RESAMPLE or NONE 
+   */
+  void setBounds(const vector<double>& _lowerBound,const vector<double>& _upperBound,BoundRepair::Repair _repair=BoundRepair::REFLECT) {
+    boundRepair.setBounds(_lowerBound,_upperBound);
+    setBoundRepair(_repair);
+  }
+
+  /**
+   * @param _repair repair of neighbors leaving the bounds: BoundRepair::CLIP, REFLECT, RESAMPLE or NONE 
+   */
+  void setBoundRepair(BoundRepair::Repair _repair) {
+    boundRepair.setMode(_repair);
+    neighborhood.setRepair(&boundRepair);
+  }
+
+  /**
+   * stop the evaluation of neighbors as soon as they cannot be selected any more 
+   * (@see moBoundedEvalByModif), only for hill climbing and objectives with a 
+   * bounded evaluation. It is not used together with a surrogate, an archive 
+   * or a cache which need exact values. 
+   */
+  void setBoundedEval(bool _bounded=true) {
+    if(initialized) 
+      std::cerr << "setBoundedEval(): object already initialized\n";
+    boundedEval = _bounded; 
+  }
+
+  /**
+   * consult a persistent cache of objective values (@see EvalCache) shared 
+   * among runs and processes, new objective values are added to the cache 
+   * 
+   * @param _file      cache file 
+   * @param _capacity  max. number of cached points of a new cache 
+   * @param _identity  identity of the objective function (empty: RSRRMVOF::identity()) 
+   * @return false if the cache cannot be opened 
+   */
+  bool setCache(const std::string& _file,unsigned long long _capacity=1048576,const std::string& _identity="") {
+    if(initialized) 
+      std::cerr << "setCache(): object already initialized\n";
+    return cacheEval.open(_file,solution.size(),_capacity,_identity.empty() ? mainEval.identity() : _identity);
+  }
+
+  /**
+   * append all evaluated points to a memory mapped archive (@see EvalArchive), 
+   * an existing archive is continued 
+   * 
+   * @param _file  archive file 
+   * @return false if the archive cannot be opened 
+   */
+  bool setArchive(const std::string& _file) {
+    if(initialized) 
+      std::cerr << "setArchive(): object already initialized\n";
+    return archiveEval.open(_file,solution.size());
+  }
+
+  /**
+   * write a binary checkpoint each _every iterations and at the end of the run 
+   * 
+   * @param _file   checkpoint file 
+   * @param _every  checkpoint frequency in iterations 
+   */
+  void setCheckpoint(const std::string& _file,unsigned int _every=100) {
+    if(initialized) 
+      std::cerr << "setCheckpoint(): object already initialized\n";
+    delete checkpoint; 
+    checkpoint = new CheckpointSaver(eval,_file,_every);
+  }
+
+  /**
+   * add a continuator to the stopping criteria, e.g. a statistic or an 
+   * observer called once per iteration; the object is not owned 
+   * 
+   * @param _continuator  continuator, lives until the end of the run 
+   */
+  void addContinuator(moContinuator<Neighbor>& _continuator) {
+    sc.add(_continuator);
+  }
+
+  /**
+   * resume a run from a checkpoint: the incumbent, the evaluation and 
+   * iteration counters and the random number generator are restored, 
+   * the stopping criteria count the evaluations and iterations in total. 
+   * The internal state of the explorer (temperature, tabu list, quasi-Newton 
+   * matrix, ...) restarts from the incumbent. Call before init(). 
+   * 
+   * @param _file  checkpoint file 
+   * @return false if there is no valid local search checkpoint 
+   */
+  bool resume(const std::string& _file) {
+    Checkpoint cp; 
+    if(!cp.load(_file) || cp.kind != Checkpoint::LOCALSEARCH || cp.size() != 1) {
+      std::cerr << "resume(): no valid checkpoint " << _file << std::endl;
+      return false;
+    }
+    cp.getSolution(0,solution);
+    eval.value() = cp.evaluations;
+    cp.getRng(rng);
+    resumedIterations = cp.steps;
+    resumed = true;
+    return true;
+  }
+
+  /**
+   * pre-screen the neighbors by a surrogate model trained on all neighbor 
+   * evaluations, only the most promising fraction of the neighbors is 
+   * evaluated. The manager takes the ownership of the model. 
+   * 
+   * @param _surrogate  e.g. new moRBFSurrogate() or new moQuadraticSurrogate()
+   * @param _fraction   fraction of the neighbors which is evaluated ]0,1]
+   */
+  void setSurrogate(moSurrogate* _surrogate,double _fraction=0.25) {
+    if(initialized) 
+      std::cerr << "setSurrogate(): object already initialized\n";
+    delete surrogate; 
+    surrogate = _surrogate; 
+    surrogateEval.setModel(surrogate);
+    screening.setSurrogate(surrogate,_fraction);
+    neighborhood.setScreening(&screening);
+  }
+
   /// Initialize the object
   virtual void init() {
     initLS();
     if(!this->initialized) { 
+      if(checkpoint != 0) {
+	checkpoint->setIterations(resumedIterations);
+	this->sc.add(*checkpoint);
+      }
+      // the iterations are counted in total after a resume 
+      maxiter.setIterations(resumedIterations);
+      if(archiveEval.getArchive() != 0) {
+	archiveStep.setIterations(resumedIterations);
+	this->sc.add(archiveStep);
+      }
+      if(boundedEval) {
+	if(typeid(LocalSearch) != typeid(SimpleHillClimbing) && typeid(LocalSearch) != typeid(FirstImprHillClimbing)) 
+	  std::cerr << "init(): bounded evaluation is only used by hill climbing\n";
+	else if(surrogate != 0 || archiveEval.getArchive() != 0 || cacheEval.getCache() != 0) 
+	  std::cerr << "init(): bounded evaluation is not used with a surrogate, archive or cache\n";
+	else 
+	  boundedNeighborEval.setBounded(true);
+      }
       this->ls->setContinuator(this->sc);
     }
     this->initialized = true;
-    this->solution.invalidate();
+    // the restored incumbent keeps its fitness 
+    if(!resumed) this->solution.invalidate();
   }
 
   /**
    * Initialize the Local search, with a maximum allowed number of function evaluations
+   * (in total, i.e. including the evaluations before a resume)
    * 
    * @param _maxFullEval: maximum number of function evaluations 
    */
   virtual void init(unsigned int _maxFullEval) {
-    maxeval = new MaxNumEval(eval,_maxFullEval);
+    unsigned long done = resumed ? eval.value() : 0; 
+    maxeval = new MaxNumEval(eval,_maxFullEval > done ? _maxFullEval - done : 0);
     if(!this->initialized) this->sc.add(*maxeval);
     init();
   }
@@ -171,21 +367,39 @@ protected:
   /// main goal function depending on realfunc.h 
   eoObjFunc mainEval; 
 
-  /// neighborhood object 
-  Neighborhood neighborhood;  
+  /// neighborhood object, its radius is adapted by the outcome of the neighbor evaluations 
+  AdaptiveNeighborhood neighborhood;  
+
+  /// repair of the neighbors leaving the bounds 
+  BoundRepair boundRepair; 
+
+  /// pre-screening of the neighbors by the surrogate model 
+  moRealScreening screening; 
+
+  /// goal function consulting the cache 
+  CacheEval cacheEval; 
+
+  /// goal function appending to the archive 
+  ArchiveEval archiveEval; 
 
   /// goal function counter 
   GoalFuncCounter eval; 
 
-  /// goal function for solution neighbors 
-  NeighborEval neighborEval; 
+  /// counted goal function training the surrogate model 
+  SurrogateEval surrogateEval; 
+
+  /// goal function for solution neighbors, bounded by hill climbers 
+  moBoundedEvalByModif<Neighbor,eoObjFunc> boundedNeighborEval; 
+
+  /// goal function for solution neighbors reporting to the success rule of the neighborhood 
+  SuccessRateEval neighborEval; 
 
   /// The local search 
   //LocalSearch* ls; 
   moLocalSearch<Neighbor>* ls;
 
   /// Maximum num. iteration 
-  MaxNumIter maxiter; 
+  TotalNumIter maxiter; 
 
   /// Maxumum num. function evaluation
   MaxNumEval* maxeval; 
@@ -193,6 +407,27 @@ protected:
   /// Stopping Criteria
   StoppingCriteria sc; 
 
+  /// surrogate model for pre-screening of neighbors (0: none)
+  moSurrogate* surrogate; 
+
+  /// sampler of the neighbor offsets (0: pseudo random)
+  moRealSampler* sampler; 
+
+  /// periodic checkpoint (0: none)
+  CheckpointSaver* checkpoint; 
+
+  /// whether the run is resumed from a checkpoint 
+  bool resumed; 
+
+  /// number of iterations before the resume 
+  unsigned long resumedIterations; 
+
+  /// iteration counter of the archive 
+  ArchiveStep archiveStep; 
+
+  /// whether neighbors are evaluated with a cutoff 
+  bool boundedEval; 
+
  private:
   
   /// prevent copy cor
@@ -410,4 +645,587 @@ public:
 
 
 
+/** 
+ * \class LocalSearchManagerQN 
+ * 
+ * Local search Manager for the quasi-Newton method 
+ */ 
+template<class eoObjFunc>
+class LocalSearchManagerQN: public LocalSearchManager<QuasiNewton,eoObjFunc> {
+
+public:
+
+  /**
+   * default Constructor
+   * 
+   * @param _initial initial solution
+   * @param _numNeighbors number of neighbors 
+   * @param _boundaryRadius neighborhood boundary radius 
+   * @param _maxiter maximum number of iteration
+   */  
+  LocalSearchManagerQN(const EORVT& _initial,
+		       uint32_t _numNeighbors=50,double _boundaryRadius=0.1,
+		       unsigned int _maxiter = getMaxUnsignedInt()) : LocalSearchManager<QuasiNewton,eoObjFunc>(_initial,_numNeighbors,_boundaryRadius,_maxiter),memory(0),central(false),fdStep(0.0),gradTol(1e-8),analytic(true) { }
+
+ /**
+   * default Constructor
+   * 
+   * @param _lowerBound  lower bounds of initial solution
+   * @param _upperBound  upper bounds of initial solution
+   * @param _numNeighbors number of neighbors 
+   * @param _boundaryRadius neighborhood boundary radius 
+   * @param _maxiter maximum number of iteration
+   */ 
+ LocalSearchManagerQN(const vector<double>& _lowerBound,const vector<double>& _upperBound,uint32_t _numNeighbors,double _boundaryRadius,unsigned int _maxiter=getMaxUnsignedInt()) : LocalSearchManager<QuasiNewton,eoObjFunc>(_lowerBound,_upperBound,_numNeighbors,_boundaryRadius,_maxiter),memory(0),central(false),fdStep(0.0),gradTol(1e-8),analytic(true) {}
+
+
+  /// Initialize the object
+  virtual void initLS() {
+    if(!this->initialized) {
+      QuasiNewton* qn = new QuasiNewton(this->neighborhood,this->eval,this->neighborEval,memory,central);
+      qn->getExplorer().setFDStep(fdStep);
+      qn->getExplorer().setGradTol(gradTol);
+      if(analytic) qn->getExplorer().setGradient(&this->mainEval,this->eval);
+      this->ls = qn;
+    }
+  }
+
+  /**
+   * set number of correction pairs of L-BFGS (0: BFGS) 
+   */ 
+  void setMemory(unsigned int _memory) {
+    memory = _memory;
+  }
+
+  /**
+   * set whether central differences (2n evaluations) are used instead of forward differences (n evaluations)
+   */ 
+  void setCentralDifferences(bool _central) {
+    central = _central;
+  }
+
+  /**
+   * set relative finite difference step (0: default)
+   */ 
+  void setFDStep(double _fdStep) {
+    fdStep = _fdStep;
+  }
+
+  /**
+   * set tolerance of the gradient norm
+   */ 
+  void setGradTol(double _gradTol) {
+    gradTol = _gradTol;
+  }
+
+  /**
+   * set whether the gradient of the objective function is used if it provides one (@see eoADObjFunc)
+   */ 
+  void setAnalyticGradient(bool _analytic) {
+    analytic = _analytic;
+  }
+
+ protected:
+
+  /** number of correction pairs of L-BFGS */ 
+  unsigned int memory;
+
+  /** whether central differences are used */ 
+  bool central;
+
+  /** relative finite difference step */ 
+  double fdStep;
+
+  /** tolerance of the gradient norm */ 
+  double gradTol;
+
+  /** whether the gradient of the objective function is used */ 
+  bool analytic;
+
+};
+
+
+/** 
+ * \class LocalSearchManagerSPSA 
+ * 
+ * Local search Manager for the simultaneous perturbation stochastic approximation 
+ */ 
+template<class eoObjFunc>
+class LocalSearchManagerSPSA: public LocalSearchManager<SPSA,eoObjFunc> {
+
+public:
+
+  /**
+   * default Constructor
+   * 
+   * @param _initial initial solution
+   * @param _numNeighbors number of neighbors 
+   * @param _boundaryRadius neighborhood boundary radius 
+   * @param _maxiter maximum number of iteration
+   */  
+  LocalSearchManagerSPSA(const EORVT& _initial,
+			 uint32_t _numNeighbors=50,double _boundaryRadius=0.1,
+			 unsigned int _maxiter = getMaxUnsignedInt()) : LocalSearchManager<SPSA,eoObjFunc>(_initial,_numNeighbors,_boundaryRadius,_maxiter),numAverages(1),a(0.1),c(0.1),A(10.0),alpha(0.602),gamma(0.101),evalIterate(false) { }
+
+ /**
+   * default Constructor
+   * 
+   * @param _lowerBound  lower bounds of initial solution
+   * @param _upperBound  upper bounds of initial solution
+   * @param _numNeighbors number of neighbors 
+   * @param _boundaryRadius neighborhood boundary radius 
+   * @param _maxiter maximum number of iteration
+   */ 
+ LocalSearchManagerSPSA(const vector<double>& _lowerBound,const vector<double>& _upperBound,uint32_t _numNeighbors,double _boundaryRadius,unsigned int _maxiter=getMaxUnsignedInt()) : LocalSearchManager<SPSA,eoObjFunc>(_lowerBound,_upperBound,_numNeighbors,_boundaryRadius,_maxiter),numAverages(1),a(0.1),c(0.1),A(10.0),alpha(0.602),gamma(0.101),evalIterate(false) {}
+
+
+  /// Initialize the object
+  virtual void initLS() {
+    if(!this->initialized) {
+      SPSA* spsa = new SPSA(this->neighborhood,this->eval,this->neighborEval,numAverages);
+      spsa->getExplorer().setGains(a,c,A,alpha,gamma);
+      spsa->getExplorer().setEvalIterate(evalIterate);
+      this->ls = spsa;
+    }
+  }
+
+  /**
+   * set number of averaged gradient estimates per iteration (2 evaluations each), 
+   * an iteration costs 2 * _numAverages evaluations (+ 1 with setEvalIterate(true))
+   */ 
+  void setNumAverages(unsigned int _numAverages) {
+    numAverages = _numAverages > 0 ? _numAverages : 1;
+  }
+
+  /**
+   * evaluate each new iterate instead of estimating its fitness (@see moSPSAExplorer)
+   */ 
+  void setEvalIterate(bool _evalIterate) {
+    evalIterate = _evalIterate;
+  }
+
+  /**
+   * set gain sequences a_k = a / (k + 1 + A)^alpha , c_k = c / (k + 1)^gamma
+   */ 
+  void setGains(double _a,double _c,double _A=10.0,double _alpha=0.602,double _gamma=0.101) {
+    a = _a;
+    c = _c;
+    A = _A;
+    alpha = _alpha;
+    gamma = _gamma;
+  }
+
+ protected:
+
+  /** number of averaged gradient estimates */ 
+  unsigned int numAverages;
+
+  /** step gain */ 
+  double a;
+
+  /** perturbation gain */ 
+  double c;
+
+  /** stability constant of the step gain */ 
+  double A;
+
+  /** decay exponent of the step gain */ 
+  double alpha;
+
+  /** decay exponent of the perturbation gain */ 
+  double gamma;
+
+  /** whether the new iterates are evaluated */ 
+  bool evalIterate;
+
+};
+
+
+/** 
+ * \class LocalSearchManagerLM 
+ * 
+ * Local search Manager for the Levenberg-Marquardt method, 
+ * the objective function should provide residuals (@see RSRRMVOF::residuals())
+ */ 
+template<class eoObjFunc>
+class LocalSearchManagerLM: public LocalSearchManager<LevenbergMarquardt,eoObjFunc> {
+
+public:
+
+  /**
+   * default Constructor
+   * 
+   * @param _initial initial solution
+   * @param _numNeighbors number of neighbors 
+   * @param _boundaryRadius neighborhood boundary radius 
+   * @param _maxiter maximum number of iteration
+   */  
+  LocalSearchManagerLM(const EORVT& _initial,
+		       uint32_t _numNeighbors=50,double _boundaryRadius=0.1,
+		       unsigned int _maxiter = getMaxUnsignedInt()) : LocalSearchManager<LevenbergMarquardt,eoObjFunc>(_initial,_numNeighbors,_boundaryRadius,_maxiter),refresh(10),fdStep(0.0),gradTol(1e-10),damping(1e-3) { }
+
+ /**
+   * default Constructor
+   * 
+   * @param _lowerBound  lower bounds of initial solution
+   * @param _upperBound  upper bounds of initial solution
+   * @param _numNeighbors number of neighbors 
+   * @param _boundaryRadius neighborhood boundary radius 
+   * @param _maxiter maximum number of iteration
+   */ 
+ LocalSearchManagerLM(const vector<double>& _lowerBound,const vector<double>& _upperBound,uint32_t _numNeighbors,double _boundaryRadius,unsigned int _maxiter=getMaxUnsignedInt()) : LocalSearchManager<LevenbergMarquardt,eoObjFunc>(_lowerBound,_upperBound,_numNeighbors,_boundaryRadius,_maxiter),refresh(10),fdStep(0.0),gradTol(1e-10),damping(1e-3) {}
+
+
+  /// Initialize the object
+  virtual void initLS() {
+    if(!this->initialized) {
+      LevenbergMarquardt* lm = new LevenbergMarquardt(this->neighborhood,this->eval,this->neighborEval,&this->mainEval,refresh);
+      lm->getExplorer().setFDStep(fdStep);
+      lm->getExplorer().setGradTol(gradTol);
+      lm->getExplorer().setInitialDamping(damping);
+      this->ls = lm;
+    }
+  }
+
+  /**
+   * set num. of iterations between finite difference Jacobians, Broyden updates in between (1: none)
+   */ 
+  void setRefresh(unsigned int _refresh) {
+    refresh = _refresh;
+  }
+
+  /**
+   * set relative finite difference step (0: default)
+   */ 
+  void setFDStep(double _fdStep) {
+    fdStep = _fdStep;
+  }
+
+  /**
+   * set tolerance of the gradient norm
+   */ 
+  void setGradTol(double _gradTol) {
+    gradTol = _gradTol;
+  }
+
+  /**
+   * set initial damping relative to the largest diagonal element of J^T J
+   */ 
+  void setInitialDamping(double _damping) {
+    damping = _damping;
+  }
+
+ protected:
+
+  /** num. of iterations between finite difference Jacobians */ 
+  unsigned int refresh;
+
+  /** relative finite difference step */ 
+  double fdStep;
+
+  /** tolerance of the gradient norm */ 
+  double gradTol;
+
+  /** initial damping */ 
+  double damping;
+
+};
+
+
+/** 
+ * \class LocalSearchManagerPS 
+ * 
+ * Local search Manager for the pattern search (Hooke-Jeeves / GPS) 
+ */ 
+template<class eoObjFunc>
+class LocalSearchManagerPS: public LocalSearchManager<PatternSearch,eoObjFunc> {
+
+public:
+
+  /**
+   * default Constructor
+   * 
+   * @param _initial initial solution
+   * @param _numNeighbors number of neighbors 
+   * @param _boundaryRadius neighborhood boundary radius 
+   * @param _maxiter maximum number of iteration
+   */  
+  LocalSearchManagerPS(const EORVT& _initial,
+		       uint32_t _numNeighbors=50,double _boundaryRadius=0.1,
+		       unsigned int _maxiter = getMaxUnsignedInt()) : LocalSearchManager<PatternSearch,eoObjFunc>(_initial,_numNeighbors,_boundaryRadius,_maxiter),step(_boundaryRadius),minStep(1e-8),expansion(2.0),contraction(0.5),minimal(false),bestPoll(false),orderCache(false) { }
+
+ /**
+   * default Constructor
+   * 
+   * @param _lowerBound  lower bounds of initial solution
+   * @param _upperBound  upper bounds of initial solution
+   * @param _numNeighbors number of neighbors 
+   * @param _boundaryRadius neighborhood boundary radius 
+   * @param _maxiter maximum number of iteration
+   */ 
+ LocalSearchManagerPS(const vector<double>& _lowerBound,const vector<double>& _upperBound,uint32_t _numNeighbors,double _boundaryRadius,unsigned int _maxiter=getMaxUnsignedInt()) : LocalSearchManager<PatternSearch,eoObjFunc>(_lowerBound,_upperBound,_numNeighbors,_boundaryRadius,_maxiter),step(_boundaryRadius),minStep(1e-8),expansion(2.0),contraction(0.5),minimal(false),bestPoll(false),orderCache(false) {}
+
+
+  /// Initialize the object
+  virtual void initLS() {
+    if(!this->initialized) {
+      PatternSearch* ps = new PatternSearch(this->neighborhood,this->eval,this->neighborEval,step,minStep);
+      ps->getExplorer().setFactors(expansion,contraction);
+      ps->getExplorer().setMinimalPollSet(minimal);
+      ps->getExplorer().setOpportunistic(!bestPoll);
+      ps->getExplorer().setOrderCache(orderCache);
+      this->ls = ps;
+    }
+  }
+
+  /**
+   * set initial step and minimal step for stopping
+   */ 
+  void setSteps(double _step,double _minStep) {
+    step = _step;
+    minStep = _minStep;
+  }
+
+  /**
+   * set expansion factor of the step on success and contraction factor on failure
+   */ 
+  void setFactors(double _expansion,double _contraction) {
+    expansion = _expansion;
+    contraction = _contraction;
+  }
+
+  /**
+   * set whether the minimal positive spanning set (n+1 directions) is polled instead of the compass (2n)
+   */ 
+  void setMinimalPollSet(bool _minimal) {
+    minimal = _minimal;
+  }
+
+  /**
+   * set whether the best poll point is taken instead of the first improving one
+   */ 
+  void setBestPoll(bool _bestPoll) {
+    bestPoll = _bestPoll;
+  }
+
+  /**
+   * set whether successful directions are polled first in the following iterations
+   */ 
+  void setOrderCache(bool _orderCache) {
+    orderCache = _orderCache;
+  }
+
+ protected:
+
+  /** initial step */ 
+  double step;
+
+  /** minimal step */ 
+  double minStep;
+
+  /** expansion factor of the step */ 
+  double expansion;
+
+  /** contraction factor of the step */ 
+  double contraction;
+
+  /** whether the minimal positive spanning set is polled */ 
+  bool minimal;
+
+  /** whether the best poll point is taken */ 
+  bool bestPoll;
+
+  /** whether successful directions are polled first */ 
+  bool orderCache;
+
+};
+
+
+/** 
+ * \class LocalSearchManagerNM 
+ * 
+ * Local search Manager for the Nelder-Mead simplex method, 
+ * the candidates are projected onto the bounds of the initial solution 
+ */ 
+template<class eoObjFunc>
+class LocalSearchManagerNM: public LocalSearchManager<NelderMead,eoObjFunc> {
+
+public:
+
+  /**
+   * default Constructor
+   * 
+   * @param _initial initial solution
+   * @param _numNeighbors number of neighbors 
+   * @param _boundaryRadius neighborhood boundary radius 
+   * @param _maxiter maximum number of iteration
+   */  
+  LocalSearchManagerNM(const EORVT& _initial,
+		       uint32_t _numNeighbors=50,double _boundaryRadius=0.1,
+		       unsigned int _maxiter = getMaxUnsignedInt()) : LocalSearchManager<NelderMead,eoObjFunc>(_initial,_numNeighbors,_boundaryRadius,_maxiter),step(_boundaryRadius),numParallel(1),speculative(false),adaptive(false),xTol(1e-8),fTol(1e-12) { }
+
+ /**
+   * default Constructor
+   * 
+   * @param _lowerBound  lower bounds of initial solution
+   * @param _upperBound  upper bounds of initial solution
+   * @param _numNeighbors number of neighbors 
+   * @param _boundaryRadius neighborhood boundary radius 
+   * @param _maxiter maximum number of iteration
+   */ 
+ LocalSearchManagerNM(const vector<double>& _lowerBound,const vector<double>& _upperBound,uint32_t _numNeighbors,double _boundaryRadius,unsigned int _maxiter=getMaxUnsignedInt()) : LocalSearchManager<NelderMead,eoObjFunc>(_lowerBound,_upperBound,_numNeighbors,_boundaryRadius,_maxiter),step(_boundaryRadius),numParallel(1),speculative(false),adaptive(false),xTol(1e-8),fTol(1e-12),lowerBound(_lowerBound),upperBound(_upperBound) {}
+
+
+  /// Initialize the object
+  virtual void initLS() {
+    if(!this->initialized) {
+      NelderMead* nm = new NelderMead(this->neighborhood,this->eval,this->neighborEval,step);
+      nm->getExplorer().setBounds(lowerBound,upperBound);
+      nm->getExplorer().setNumParallel(numParallel);
+      nm->getExplorer().setSpeculative(speculative);
+      nm->getExplorer().setAdaptive(adaptive);
+      nm->getExplorer().setTolerances(xTol,fTol);
+      this->ls = nm;
+    }
+  }
+
+  /**
+   * set edge length of the initial simplex (relative to the bounds if given)
+   */ 
+  void setStep(double _step) {
+    step = _step;
+  }
+
+  /**
+   * set number of worst vertices replaced concurrently per iteration (1: classical method)
+   */ 
+  void setNumParallel(unsigned int _numParallel) {
+    numParallel = _numParallel;
+  }
+
+  /**
+   * set whether reflection, expansion and contractions are evaluated concurrently
+   */ 
+  void setSpeculative(bool _speculative) {
+    speculative = _speculative;
+  }
+
+  /**
+   * set whether the coefficients are adapted to the dimension
+   */ 
+  void setAdaptive(bool _adaptive) {
+    adaptive = _adaptive;
+  }
+
+  /**
+   * set tolerances of the simplex size and of the spread of the objective values
+   */ 
+  void setTolerances(double _xTol,double _fTol) {
+    xTol = _xTol;
+    fTol = _fTol;
+  }
+
+ protected:
+
+  /** edge length of the initial simplex */ 
+  double step;
+
+  /** number of worst vertices replaced per iteration */ 
+  unsigned int numParallel;
+
+  /** whether all candidates are evaluated in a single round */ 
+  bool speculative;
+
+  /** whether the coefficients depend on the dimension */ 
+  bool adaptive;
+
+  /** tolerance of the simplex size */ 
+  double xTol;
+
+  /** tolerance of the objective values */ 
+  double fTol;
+
+  /** bounds of the initial solution (empty: unbounded) */ 
+  vector<double> lowerBound,upperBound;
+
+};
+
+
+/** 
+ * \class LocalSearchManagerTR 
+ * 
+ * Local search Manager for the derivative-free trust region method, 
+ * the bounds of the initial solution are hard constraints 
+ */ 
+template<class eoObjFunc>
+class LocalSearchManagerTR: public LocalSearchManager<TrustRegion,eoObjFunc> {
+
+public:
+
+  /**
+   * default Constructor
+   * 
+   * @param _initial initial solution
+   * @param _numNeighbors number of neighbors 
+   * @param _boundaryRadius neighborhood boundary radius 
+   * @param _maxiter maximum number of iteration
+   */  
+  LocalSearchManagerTR(const EORVT& _initial,
+		       uint32_t _numNeighbors=50,double _boundaryRadius=0.1,
+		       unsigned int _maxiter = getMaxUnsignedInt()) : LocalSearchManager<TrustRegion,eoObjFunc>(_initial,_numNeighbors,_boundaryRadius,_maxiter),initRadius(_boundaryRadius),endRadius(1e-8),numGeometry(1) { }
+
+ /**
+   * default Constructor
+   * 
+   * @param _lowerBound  lower bounds of initial solution
+   * @param _upperBound  upper bounds of initial solution
+   * @param _numNeighbors number of neighbors 
+   * @param _boundaryRadius neighborhood boundary radius 
+   * @param _maxiter maximum number of iteration
+   */ 
+ LocalSearchManagerTR(const vector<double>& _lowerBound,const vector<double>& _upperBound,uint32_t _numNeighbors,double _boundaryRadius,unsigned int _maxiter=getMaxUnsignedInt()) : LocalSearchManager<TrustRegion,eoObjFunc>(_lowerBound,_upperBound,_numNeighbors,_boundaryRadius,_maxiter),initRadius(_boundaryRadius),endRadius(1e-8),numGeometry(1),lowerBound(_lowerBound),upperBound(_upperBound) {}
+
+
+  /// Initialize the object
+  virtual void initLS() {
+    if(!this->initialized) {
+      TrustRegion* tr = new TrustRegion(this->neighborhood,this->eval,this->neighborEval,initRadius,endRadius);
+      tr->getExplorer().setBounds(lowerBound,upperBound);
+      tr->getExplorer().setNumGeometry(numGeometry);
+      this->ls = tr;
+    }
+  }
+
+  /**
+   * set initial and final trust region radius (relative to the bounds if given)
+   */ 
+  void setRadii(double _initRadius,double _endRadius) {
+    initRadius = _initRadius;
+    endRadius = _endRadius;
+  }
+
+  /**
+   * set max. number of geometry improving points evaluated concurrently
+   */ 
+  void setNumGeometry(unsigned int _numGeometry) {
+    numGeometry = _numGeometry;
+  }
+
+ protected:
+
+  /** initial trust region radius */ 
+  double initRadius;
+
+  /** final trust region radius */ 
+  double endRadius;
+
+  /** max. number of concurrent geometry improving points */ 
+  unsigned int numGeometry;
+
+  /** bounds of the initial solution (empty: unbounded) */ 
+  vector<double> lowerBound,upperBound;
+
+};
+
+
 #endif
@@ -0,0 +1,472 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+ * \file moLevenbergMarquardt.h
+ *
+ * @date   : Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+#ifndef _moLevenbergMarquardt_h
+#define _moLevenbergMarquardt_h
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "algo/moLocalSearch.h"
+#include "explorer/moNeighborhoodExplorer.h"
+#include "continuator/moTrueContinuator.h"
+
+#include "util/LinearAlgebra.h"
+#include "util/ParallelEval.h"
+
+/**
+ * \class moLevenbergMarquardtExplorer
+ *
+ * Explorer of the Levenberg-Marquardt method for least squares objectives
+ * f(x) = sum_i r_i(x)^2 (@see RSRRMVOF::residuals()). Each step solves
+ *
+ *   (J^T J + lambda D) delta = - J^T r ,  D = diag(J^T J)
+ *
+ * and adapts the damping lambda by the ratio of the actual and the predicted
+ * decrease. The Jacobian J is
+ * - computed by forward differences (n residual evaluations), the columns
+ *   are evaluated concurrently, every refresh iterations and whenever a step
+ *   with an approximated Jacobian fails
+ * - updated by Broyden's rank-one formula after every successful step in
+ *   between (no additional evaluations)
+ *
+ * Objectives without residuals are treated as the single residual sqrt(f),
+ * as well as a missing objective, then the full evaluation function is used.
+ * Each residual vector is counted as one evaluation of the objective.
+ * Residual vectors are computed by the objective directly, i.e. they are
+ * never taken from the cache nor appended to the archive of the manager
+ * (both hold objective values only).
+ */
+template<class Neighbor,class ObjFunc>
+class moLevenbergMarquardtExplorer : public moNeighborhoodExplorer<Neighbor>
+{
+public:
+
+  typedef typename Neighbor::EOT EOT;
+  typedef moNeighborhood<Neighbor> Neighborhood;
+
+  /**
+   * Cor
+   *
+   * @param _neighborhood the neighborhood (not used)
+   * @param _eval neighbor's evaluation function (not used)
+   * @param _fullEval thread-safe full evaluation function, counting the evaluations
+   * @param _objective objective function providing the residuals, reentrant (0: sqrt of the full evaluation)
+   * @param _refresh num. of iterations between finite difference Jacobians (1: no Broyden updates)
+   * @param _fdStep relative finite difference step, 0 for default
+   */
+  moLevenbergMarquardtExplorer(Neighborhood& _neighborhood,
+			       moEval<Neighbor>& _eval,
+			       eoEvalFuncCounter<EOT>& _fullEval,
+			       ObjFunc* _objective=0,
+			       unsigned int _refresh=10,
+			       double _fdStep=0.0)
+    : moNeighborhoodExplorer<Neighbor>(_neighborhood,_eval),fullEval(_fullEval),objective(_objective),
+    refresh(std::max(1u,_refresh)),fdStep(_fdStep),gradTol(1e-10),xTol(1e-12),lambda0(1e-3) { }
+
+  /**
+   * set the number of iterations between finite difference Jacobians, the
+   * Jacobian is updated by Broyden's formula in between (1: always finite differences)
+   */
+  void setRefresh(unsigned int _refresh) {
+    refresh = std::max(1u,_refresh);
+  }
+
+  /**
+   * set relative step of the finite difference, h_i = fdStep * max(1,|x_i|)
+   */
+  void setFDStep(double _fdStep) {
+    fdStep = _fdStep;
+  }
+
+  /**
+   * set tolerance of the gradient norm |J^T r| for stopping
+   */
+  void setGradTol(double _gradTol) {
+    gradTol = _gradTol;
+  }
+
+  /**
+   * set tolerance of the relative step length for stopping
+   */
+  void setXTol(double _xTol) {
+    xTol = _xTol;
+  }
+
+  /**
+   * set initial damping relative to the largest diagonal element of J^T J
+   */
+  void setInitialDamping(double _lambda0) {
+    lambda0 = _lambda0;
+  }
+
+  /**
+   * initialization of the Levenberg-Marquardt state
+   * @param _solution the initial solution
+   */
+  virtual void initParam(EOT& _solution) {
+    n = _solution.size();
+    m = objective == 0 ? 1 : std::max(1UL,(unsigned long) objective->numResiduals(n));
+    J.assign(m*n,0.0);
+    A.assign(n*n,0.0);
+    g.assign(n,0.0);
+    delta.assign(n,0.0);
+    h.assign(n,0.0);
+    r.clear();
+    rTrial.assign(m,0.0);
+    residualsOf(_solution,r);
+    f = LinearAlgebra::dot(&r[0],&r[0],m);
+    _solution.fitness(f);
+    age = refresh;
+    fresh = false;
+    lambda = -1.0;
+    nu = 2.0;
+    improved = false;
+    converged = false;
+  }
+
+  /// nothing to update
+  virtual void updateParam(EOT& _solution) { }
+
+  /// nothing to terminate
+  virtual void terminate(EOT& _solution) { }
+
+  /**
+   * compute (or update) the Jacobian and try damped Gauss-Newton steps
+   * until one decreases the objective or the Jacobian has to be refreshed
+   * @param _solution the current solution
+   */
+  virtual void operator()(EOT& _solution) {
+    improved = false;
+    if(age >= refresh) jacobian(_solution);
+    // J and r only change by a refreshed Jacobian within the trials
+    normalEquations();
+    for(int trial=0;trial<30 && !improved && !converged;trial++) {
+      double gnorm = std::sqrt(LinearAlgebra::dot(&g[0],&g[0],n));
+      if(gnorm < gradTol) {
+	if(fresh) converged = true;
+	else refreshJacobian(_solution);
+	continue;
+      }
+      if(lambda < 0.0) {
+	double amax = 0.0;
+	for(unsigned i=0;i<n;i++) amax = std::max(amax,A[i*n+i]);
+	lambda = lambda0 * std::max(amax,1e-12);
+      }
+      if(!solve()) {
+	lambda *= nu;
+	nu *= 2.0;
+	continue;
+      }
+      double dnorm = std::sqrt(LinearAlgebra::dot(&delta[0],&delta[0],n));
+      double xnorm = 0.0;
+      for(unsigned i=0;i<n;i++) xnorm += (double) _solution[i] * (double) _solution[i];
+      if(dnorm <= xTol * (std::sqrt(xnorm) + xTol)) {
+	if(fresh) converged = true;
+	else refreshJacobian(_solution);
+	continue;
+      }
+      // trial step
+      candidate = _solution;
+      for(unsigned i=0;i<n;i++) candidate[i] += delta[i];
+      residualsOf(candidate,rTrial);
+      double fTrial = LinearAlgebra::dot(&rTrial[0],&rTrial[0],m);
+      // predicted decrease of the linear model: delta^T (lambda D delta - g)
+      double predicted = 0.0;
+      for(unsigned i=0;i<n;i++)
+	predicted += delta[i] * (lambda * std::max(A[i*n+i],1e-12) * delta[i] - g[i]);
+      if(fTrial < f && predicted > 0.0) {
+	broyden();
+	double rho = (f - fTrial) / predicted;
+	lambda *= std::max(1.0/3.0,1.0 - std::pow(2.0*rho - 1.0,3.0));
+	nu = 2.0;
+	candidate.fitness(fTrial);
+	improved = true;
+      } else {
+	lambda *= nu;
+	nu *= 2.0;
+	// a failure with an approximated Jacobian is not conclusive
+	if(!fresh) refreshJacobian(_solution);
+	else if(lambda > 1e16) converged = true;
+      }
+    }
+  }
+
+  /**
+   * @return whether a better solution is found
+   */
+  virtual bool accept(EOT& _solution) {
+    return improved;
+  }
+
+  /**
+   * move to the solution of the successful step
+   */
+  virtual void move(EOT& _solution) {
+    _solution = candidate;
+    r.swap(rTrial);
+    f = _solution.fitness();
+    age++;
+  }
+
+  /**
+   * @return false if the gradient or the step vanishes
+   */
+  virtual bool isContinue(EOT& _solution) {
+    return !converged && improved;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return "moLevenbergMarquardtExplorer";
+  }
+
+ protected:
+
+  /**
+   * residual vector of a solution, counted as one evaluation
+   */
+  void residualsOf(EOT& _solution,std::vector<double>& _r) {
+    if(objective == 0) {
+      _solution.invalidate();
+      fullEval(_solution);
+      _r.assign(1,std::sqrt(std::max(0.0,(double) _solution.fitness())));
+      return;
+    }
+    objective->residuals(_solution,_r);
+    _r.resize(m,0.0);
+    __sync_fetch_and_add(&(fullEval.value()),1UL);
+  }
+
+  /**
+   * forward difference Jacobian at _solution, the columns are evaluated concurrently
+   */
+  void jacobian(EOT& _solution) {
+    double step = fdStep > 0.0 ? fdStep : std::sqrt(std::numeric_limits<double>::epsilon());
+    for(unsigned j=0;j<n;j++) h[j] = step * std::max(1.0,std::fabs((double) _solution[j]));
+    age = 0;
+    fresh = true;
+    if(objective == 0) {
+      points.resize(n,_solution);
+      for(unsigned j=0;j<n;j++) {
+	points[j] = _solution;
+	points[j][j] += h[j];
+	points[j].invalidate();
+      }
+      ParallelEval::evaluate(points,fullEval);
+      for(unsigned j=0;j<n;j++)
+	J[j] = (std::sqrt(std::max(0.0,(double) points[j].fitness())) - r[0]) / h[j];
+      return;
+    }
+    int nn = n;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+      std::vector<double> x(_solution.begin(),_solution.end());
+      std::vector<double> rj;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,1)
+#endif
+      for(int j=0;j<nn;j++) {
+	double xj = x[j];
+	x[j] = xj + h[j];
+	objective->residuals(x,rj);
+	rj.resize(m,0.0);
+	x[j] = xj;
+	double* Jj = &J[j];
+	for(unsigned long i=0;i<m;i++) Jj[i*n] = (rj[i] - r[i]) / h[j];
+      }
+    }
+    __sync_fetch_and_add(&(fullEval.value()),(unsigned long) n);
+  }
+
+  /**
+   * finite difference Jacobian followed by the normal equations
+   */
+  void refreshJacobian(EOT& _solution) {
+    jacobian(_solution);
+    normalEquations();
+  }
+
+  /**
+   * normal matrix A = J^T J and gradient g = J^T r of the current J and r
+   */
+  void normalEquations() {
+    for(unsigned i=0;i<n*n;i++) A[i] = 0.0;
+    LinearAlgebra::rankUpdate(1.0,&J[0],m,n,&A[0]);
+    LinearAlgebra::multAtx(&J[0],&r[0],&g[0],m,n);
+  }
+
+  /**
+   * Broyden's rank-one update J += (r(x+delta) - r(x) - J delta) delta^T / (delta^T delta)
+   */
+  void broyden() {
+    double dd = LinearAlgebra::dot(&delta[0],&delta[0],n);
+    if(dd <= 0.0) return;
+    for(unsigned long i=0;i<m;i++) {
+      double* Ji = &J[i*n];
+      double u = (rTrial[i] - r[i] - LinearAlgebra::dot(Ji,&delta[0],n)) / dd;
+      for(unsigned j=0;j<n;j++) Ji[j] += u * delta[j];
+    }
+    fresh = false;
+  }
+
+  /**
+   * solve (J^T J + lambda D) delta = -J^T r by a Cholesky factorization
+   * @return false if the damped matrix is not positive definite
+   */
+  bool solve() {
+    std::vector<double> M(A);
+    for(unsigned i=0;i<n;i++) M[i*n+i] += lambda * std::max(A[i*n+i],1e-12);
+    if(!LinearAlgebra::cholesky(n,&M[0])) return false;
+    for(unsigned i=0;i<n;i++) delta[i] = -g[i];
+    LinearAlgebra::choleskySolve(n,&M[0],&delta[0]);
+    return true;
+  }
+
+  /// thread-safe full evaluation function, counting the evaluations
+  eoEvalFuncCounter<EOT>& fullEval;
+
+  /// objective function providing the residuals (0: none)
+  ObjFunc* objective;
+
+  /// num. of iterations between finite difference Jacobians
+  unsigned int refresh;
+
+  /// relative finite difference step
+  double fdStep;
+
+  /// tolerance of the gradient norm
+  double gradTol;
+
+  /// tolerance of the relative step length
+  double xTol;
+
+  /// initial damping relative to the largest diagonal element of J^T J
+  double lambda0;
+
+  /// dimension
+  unsigned int n;
+
+  /// number of residuals
+  unsigned long m;
+
+  /// Jacobian (m x n, row-major), normal matrix J^T J, gradient J^T r, step, fd steps
+  std::vector<double> J,A,g,delta,h;
+
+  /// residuals of the current solution and of the trial step
+  std::vector<double> r,rTrial;
+
+  /// objective value of the current solution
+  double f;
+
+  /// damping and its growth factor
+  double lambda,nu;
+
+  /// num. of iterations since the last finite difference Jacobian
+  unsigned int age;
+
+  /// whether the Jacobian is a finite difference one (no Broyden update since)
+  bool fresh;
+
+  /// points evaluated concurrently (without residuals)
+  std::vector<EOT> points;
+
+  /// solution of the successful step
+  EOT candidate;
+
+  /// whether a better solution is found
+  bool improved;
+
+  /// whether the gradient or the step vanishes
+  bool converged;
+};
+
+
+/**
+ * \class moLevenbergMarquardt
+ *
+ * Levenberg-Marquardt local search for least squares objectives with finite
+ * difference and Broyden updated Jacobians
+ */
+template<class Neighbor,class ObjFunc>
+class moLevenbergMarquardt : public moLocalSearch<Neighbor>
+{
+public:
+
+  typedef typename Neighbor::EOT EOT;
+  typedef moNeighborhood<Neighbor> Neighborhood ;
+
+  /**
+   * Basic constructor for a Levenberg-Marquardt method
+   * @param _neighborhood the neighborhood (not used)
+   * @param _fullEval the full evaluation function, counting the evaluations
+   * @param _eval neighbor's evaluation function (not used)
+   * @param _objective objective function providing the residuals, reentrant (0: sqrt of the full evaluation)
+   * @param _refresh num. of iterations between finite difference Jacobians
+   */
+  moLevenbergMarquardt(Neighborhood& _neighborhood,
+		       eoEvalFuncCounter<EOT>& _fullEval,
+		       moEval<Neighbor>& _eval,
+		       ObjFunc* _objective=0,
+		       unsigned int _refresh=10)
+    : moLocalSearch<Neighbor>(explorer,trueCont,_fullEval),
+    explorer(_neighborhood,_eval,_fullEval,_objective,_refresh)
+    {}
+
+  /**
+   * @return the Levenberg-Marquardt explorer for setting its parameters
+   */
+  moLevenbergMarquardtExplorer<Neighbor,ObjFunc>& getExplorer() {
+    return explorer;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return std::string("moLevenbergMarquardt");
+  }
+
+ private:
+
+  /// default continuator
+  moTrueContinuator<Neighbor> trueCont;
+
+  /// the Levenberg-Marquardt explorer
+  moLevenbergMarquardtExplorer<Neighbor,ObjFunc> explorer;
+};
+
+#endif
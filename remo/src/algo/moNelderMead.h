@@ -0,0 +1,510 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+ * \file moNelderMead.h
+ *
+ * @date   : Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+#ifndef _moNelderMead_h
+#define _moNelderMead_h
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "algo/moLocalSearch.h"
+#include "explorer/moNeighborhoodExplorer.h"
+#include "continuator/moTrueContinuator.h"
+
+#include "util/ParallelEval.h"
+
+/**
+ * \class moNelderMeadExplorer
+ *
+ * Explorer of the Nelder-Mead simplex method for low dimensional problems.
+ * Each iteration replaces the p worst vertices (p = 1: the classical method,
+ * p > 1: the parallel variant of Lee and Wiswall) by reflecting them through
+ * the centroid of the remaining vertices, followed by an expansion or a
+ * contraction. The candidates of all replaced vertices are evaluated
+ * concurrently; with speculative evaluation, reflection, expansion and both
+ * contractions of a vertex are evaluated concurrently as well, s.t. an
+ * iteration takes a single round of evaluations. If no vertex is replaced,
+ * the simplex shrinks towards the best vertex.
+ *
+ * Candidates are projected onto the bounds (if set). A simplex which became
+ * degenerate (e.g. flattened against a bound) is rebuilt around the best
+ * vertex with its current size. The search stops when the simplex and the
+ * spread of its objective values fall below the tolerances.
+ */
+template<class Neighbor>
+class moNelderMeadExplorer : public moNeighborhoodExplorer<Neighbor>
+{
+public:
+
+  typedef typename Neighbor::EOT EOT;
+  typedef moNeighborhood<Neighbor> Neighborhood;
+
+  /**
+   * Cor
+   *
+   * @param _neighborhood the neighborhood (not used)
+   * @param _eval neighbor's evaluation function (not used)
+   * @param _fullEval thread-safe full evaluation function
+   * @param _step edge length of the initial simplex (relative to the bounds if set)
+   */
+  moNelderMeadExplorer(Neighborhood& _neighborhood,
+		       moEval<Neighbor>& _eval,
+		       eoEvalFunc<EOT>& _fullEval,
+		       double _step=0.1)
+    : moNeighborhoodExplorer<Neighbor>(_neighborhood,_eval),fullEval(_fullEval),
+    initStep(_step),numParallel(1),speculative(false),adaptive(false),
+    xTol(1e-8),fTol(1e-12),degTol(1e-10),numRestarts(0) { }
+
+  /**
+   * set the bounds, candidates are projected onto them (empty: unbounded)
+   */
+  void setBounds(const std::vector<double>& _lowerBound,const std::vector<double>& _upperBound) {
+    lowerBound = _lowerBound;
+    upperBound = _upperBound;
+  }
+
+  /**
+   * set the edge length of the initial simplex (relative to the bounds if set)
+   */
+  void setStep(double _step) {
+    initStep = _step;
+  }
+
+  /**
+   * set the number of worst vertices replaced per iteration
+   */
+  void setNumParallel(unsigned int _numParallel) {
+    numParallel = std::max(1u,_numParallel);
+  }
+
+  /**
+   * set whether all candidates of an iteration are evaluated in a single round
+   */
+  void setSpeculative(bool _speculative) {
+    speculative = _speculative;
+  }
+
+  /**
+   * set whether the coefficients are adapted to the dimension (Gao and Han)
+   */
+  void setAdaptive(bool _adaptive) {
+    adaptive = _adaptive;
+  }
+
+  /**
+   * set the tolerances of the simplex size (relative to the bounds if set) and of the objective values
+   */
+  void setTolerances(double _xTol,double _fTol) {
+    xTol = _xTol;
+    fTol = _fTol;
+  }
+
+  /**
+   * @return number of restarts on degeneracy
+   */
+  unsigned int getNumRestarts() const {
+    return numRestarts;
+  }
+
+  /**
+   * initialization of the simplex around the initial solution
+   * @param _solution the initial solution
+   */
+  virtual void initParam(EOT& _solution) {
+    n = _solution.size();
+    bounded = lowerBound.size() == n && upperBound.size() == n;
+    scale.assign(n,1.0);
+    if(bounded)
+      for(unsigned i=0;i<n;i++) scale[i] = std::max(upperBound[i] - lowerBound[i],0.0);
+    double a = 1.0, b = 2.0, c = 0.5, d = 0.5;
+    if(adaptive && n > 1) {
+      b = 1.0 + 2.0 / n;
+      c = 0.75 - 0.5 / n;
+      d = 1.0 - 1.0 / n;
+    }
+    reflection = a;
+    expansion = b;
+    contraction = c;
+    shrinkage = d;
+    numRestarts = 0;
+    converged = false;
+    improved = false;
+    build(_solution,initStep);
+  }
+
+  /// nothing to update
+  virtual void updateParam(EOT& _solution) { }
+
+  /// nothing to terminate
+  virtual void terminate(EOT& _solution) { }
+
+  /**
+   * one iteration of the simplex method
+   * @param _solution the current solution, i.e. the best vertex
+   */
+  virtual void operator()(EOT& _solution) {
+    improved = false;
+    sortVertices();
+    unsigned p = std::min(numParallel,n);
+    unsigned kept = n + 1 - p;
+    // centroid of the kept vertices
+    centroid.assign(n,0.0);
+    for(unsigned k=0;k<kept;k++)
+      for(unsigned i=0;i<n;i++) centroid[i] += simplex[order[k]][i];
+    for(unsigned i=0;i<n;i++) centroid[i] /= kept;
+    double fBest = simplex[order[0]].fitness();
+    double fKept = simplex[order[kept-1]].fitness();
+
+    // candidates of the replaced vertices: reflection, expansion, outside and inside contraction
+    unsigned perVertex = speculative ? 4 : 1;
+    batch.resize(p * 4,_solution);
+    batchIdx.clear();
+    for(unsigned r=0;r<p;r++) {
+      const EOT& x = simplex[order[kept+r]];
+      point(batch[4*r],x,1.0 + reflection,-reflection);
+      point(batch[4*r+1],x,1.0 + reflection * expansion,-reflection * expansion);
+      point(batch[4*r+2],x,1.0 + reflection * contraction,-reflection * contraction);
+      point(batch[4*r+3],x,1.0 - contraction,contraction);
+      for(unsigned s=0;s<perVertex;s++) batchIdx.push_back(&batch[4*r+s]);
+    }
+    evaluate();
+
+    // second round for the expansions and contractions
+    if(!speculative) {
+      batchIdx.clear();
+      for(unsigned r=0;r<p;r++) {
+	double fr = batch[4*r].fitness();
+	double fx = simplex[order[kept+r]].fitness();
+	if(fr < fBest) batchIdx.push_back(&batch[4*r+1]);
+	else if(fr >= fKept) batchIdx.push_back(&batch[4*r+(fr < fx ? 2 : 3)]);
+      }
+      evaluate();
+    }
+
+    unsigned replaced = 0;
+    for(unsigned r=0;r<p;r++) {
+      EOT& x = simplex[order[kept+r]];
+      double fx = x.fitness();
+      double fr = batch[4*r].fitness();
+      int take = -1;
+      if(fr < fBest)
+	take = (double) batch[4*r+1].fitness() < fr ? 1 : 0;
+      else if(fr < fKept)
+	take = 0;
+      else if(fr < fx) {
+	if((double) batch[4*r+2].fitness() <= fr) take = 2;
+      }
+      else if((double) batch[4*r+3].fitness() < fx)
+	take = 3;
+      if(take >= 0) {
+	x = batch[4*r+take];
+	replaced++;
+      }
+    }
+    if(replaced == 0) shrink();
+
+    sortVertices();
+    EOT& best = simplex[order[0]];
+    if((double) best.fitness() < (double) _solution.fitness()) {
+      candidate = best;
+      improved = true;
+    }
+    checkSimplex();
+  }
+
+  /**
+   * @return whether the best vertex improved
+   */
+  virtual bool accept(EOT& _solution) {
+    return improved;
+  }
+
+  /**
+   * move to the best vertex
+   */
+  virtual void move(EOT& _solution) {
+    _solution = candidate;
+  }
+
+  /**
+   * @return false if the simplex converged
+   */
+  virtual bool isContinue(EOT& _solution) {
+    return !converged;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return "moNelderMeadExplorer";
+  }
+
+ protected:
+
+  /**
+   * build the simplex x, x + h_i e_i (or x - h_i e_i at an upper bound) and evaluate it concurrently
+   */
+  void build(const EOT& _x,double _step) {
+    simplex.assign(n + 1,_x);
+    for(unsigned i=0;i<n;i++) {
+      EOT& v = simplex[i+1];
+      double h = _step * (scale[i] > 0.0 ? scale[i] : 1.0);
+      if(bounded && (double) v[i] + h > upperBound[i]) h = -h;
+      v[i] += h;
+      project(v);
+      v.invalidate();
+    }
+    order.resize(n + 1);
+    for(unsigned k=0;k<=n;k++) order[k] = k;
+    batchIdx.clear();
+    for(unsigned k=0;k<=n;k++)
+      if(simplex[k].invalid()) batchIdx.push_back(&simplex[k]);
+    evaluate();
+  }
+
+  /**
+   * _p = _a * centroid + _b * _x, projected onto the bounds
+   */
+  void point(EOT& _p,const EOT& _x,double _a,double _b) {
+    _p = _x;
+    for(unsigned i=0;i<n;i++) _p[i] = _a * centroid[i] + _b * (double) _x[i];
+    project(_p);
+    _p.invalidate();
+  }
+
+  /// projection onto the bounds
+  void project(EOT& _x) {
+    if(!bounded) return;
+    for(unsigned i=0;i<n;i++)
+      _x[i] = std::min(std::max((double) _x[i],lowerBound[i]),upperBound[i]);
+  }
+
+  /// shrink the simplex towards the best vertex
+  void shrink() {
+    const EOT& best = simplex[order[0]];
+    batchIdx.clear();
+    for(unsigned k=1;k<=n;k++) {
+      EOT& v = simplex[order[k]];
+      for(unsigned i=0;i<n;i++) v[i] = (double) best[i] + shrinkage * ((double) v[i] - (double) best[i]);
+      v.invalidate();
+      batchIdx.push_back(&v);
+    }
+    evaluate();
+  }
+
+  /// evaluate the referenced points concurrently
+  void evaluate() {
+    int m = batchIdx.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+    for(int k=0;k<m;k++)
+      fullEval(*batchIdx[k]);
+  }
+
+  /// order the vertices by increasing objective values
+  void sortVertices() {
+    for(unsigned k=1;k<=n;k++) {
+      unsigned v = order[k];
+      double f = simplex[v].fitness();
+      unsigned l = k;
+      for(;l>0 && (double) simplex[order[l-1]].fitness() > f;l--) order[l] = order[l-1];
+      order[l] = v;
+    }
+  }
+
+  /**
+   * convergence and degeneracy test by Gram-Schmidt orthogonalization of the
+   * scaled edges x_k - x_best, a degenerate simplex is rebuilt
+   */
+  void checkSimplex() {
+    const EOT& best = simplex[order[0]];
+    edges.assign(n * n,0.0);
+    double diameter = 0.0, minHeight = HUGE_VAL;
+    for(unsigned k=0;k<n;k++) {
+      double* e = &edges[k*n];
+      const EOT& v = simplex[order[k+1]];
+      for(unsigned i=0;i<n;i++) {
+	e[i] = ((double) v[i] - (double) best[i]) / (scale[i] > 0.0 ? scale[i] : 1.0);
+	diameter = std::max(diameter,std::fabs(e[i]));
+      }
+    }
+    double spread = (double) simplex[order[n]].fitness() - (double) best.fitness();
+    if(diameter < xTol && spread <= fTol) {
+      converged = true;
+      return;
+    }
+    for(unsigned k=0;k<n;k++) {
+      double* e = &edges[k*n];
+      for(unsigned l=0;l<k;l++) {
+	const double* q = &edges[l*n];
+	double s = 0.0;
+	for(unsigned i=0;i<n;i++) s += e[i] * q[i];
+	for(unsigned i=0;i<n;i++) e[i] -= s * q[i];
+      }
+      double norm = 0.0;
+      for(unsigned i=0;i<n;i++) norm += e[i] * e[i];
+      norm = std::sqrt(norm);
+      minHeight = std::min(minHeight,norm);
+      if(norm > 0.0)
+	for(unsigned i=0;i<n;i++) e[i] /= norm;
+    }
+    if(minHeight < degTol * diameter) {
+      numRestarts++;
+      EOT best0 = best;
+      build(best0,std::max(diameter,xTol));
+    }
+  }
+
+  /// thread-safe full evaluation function
+  eoEvalFunc<EOT>& fullEval;
+
+  /// edge length of the initial simplex
+  double initStep;
+
+  /// number of worst vertices replaced per iteration
+  unsigned int numParallel;
+
+  /// whether all candidates are evaluated in a single round
+  bool speculative;
+
+  /// whether the coefficients depend on the dimension
+  bool adaptive;
+
+  /// tolerance of the simplex size
+  double xTol;
+
+  /// tolerance of the objective values
+  double fTol;
+
+  /// relative min. height of a non degenerate simplex
+  double degTol;
+
+  /// number of restarts on degeneracy
+  unsigned int numRestarts;
+
+  /// bounds (empty: unbounded)
+  std::vector<double> lowerBound,upperBound;
+
+  /// whether the candidates are projected onto the bounds
+  bool bounded;
+
+  /// scale of the coordinates
+  std::vector<double> scale;
+
+  /// reflection, expansion, contraction and shrinkage coefficients
+  double reflection,expansion,contraction,shrinkage;
+
+  /// dimension
+  unsigned int n;
+
+  /// vertices of the simplex
+  std::vector<EOT> simplex;
+
+  /// indices of the vertices by increasing objective values
+  std::vector<unsigned int> order;
+
+  /// centroid of the kept vertices
+  std::vector<double> centroid;
+
+  /// candidates of the replaced vertices
+  std::vector<EOT> batch;
+
+  /// points evaluated concurrently
+  std::vector<EOT*> batchIdx;
+
+  /// orthogonalized edges
+  std::vector<double> edges;
+
+  /// new best vertex
+  EOT candidate;
+
+  /// whether the best vertex improved
+  bool improved;
+
+  /// whether the simplex converged
+  bool converged;
+};
+
+
+/**
+ * \class moNelderMead
+ *
+ * Nelder-Mead simplex method with concurrent evaluation of the vertices
+ */
+template<class Neighbor>
+class moNelderMead : public moLocalSearch<Neighbor>
+{
+public:
+
+  typedef typename Neighbor::EOT EOT;
+  typedef moNeighborhood<Neighbor> Neighborhood ;
+
+  /**
+   * Basic constructor for the Nelder-Mead method
+   * @param _neighborhood the neighborhood (not used)
+   * @param _fullEval the full evaluation function, thread-safe
+   * @param _eval neighbor's evaluation function (not used)
+   * @param _step edge length of the initial simplex (relative to the bounds if set)
+   */
+  moNelderMead(Neighborhood& _neighborhood,
+	       eoEvalFunc<EOT>& _fullEval,
+	       moEval<Neighbor>& _eval,
+	       double _step=0.1)
+    : moLocalSearch<Neighbor>(explorer,trueCont,_fullEval),
+    explorer(_neighborhood,_eval,_fullEval,_step)
+    {}
+
+  /**
+   * @return the Nelder-Mead explorer for setting its parameters
+   */
+  moNelderMeadExplorer<Neighbor>& getExplorer() {
+    return explorer;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return std::string("moNelderMead");
+  }
+
+ private:
+
+  /// default continuator
+  moTrueContinuator<Neighbor> trueCont;
+
+  /// the Nelder-Mead explorer
+  moNelderMeadExplorer<Neighbor> explorer;
+};
+
+#endif
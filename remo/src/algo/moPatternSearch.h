@@ -0,0 +1,347 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+ * \file moPatternSearch.h
+ *
+ * @date   : Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+#ifndef _moPatternSearch_h
+#define _moPatternSearch_h
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "algo/moLocalSearch.h"
+#include "explorer/moNeighborhoodExplorer.h"
+#include "continuator/moTrueContinuator.h"
+
+#include "util/ParallelEval.h"
+
+/**
+ * \class moPatternSearchExplorer
+ *
+ * Explorer of a generalized pattern search (GPS) with Hooke-Jeeves pattern
+ * moves. Each iteration polls x + step * d for all directions d of a
+ * positive spanning set
+ * - compass : +-e_i (2n points)
+ * - minimal : e_i and -(1,...,1)/sqrt(n) (n+1 points)
+ * preceded by the pattern point x + (x - x_previous) after a successful
+ * iteration. All poll points are evaluated concurrently, then the first
+ * improving point in the poll order is taken (opportunistic) or the best
+ * one. A success expands the step, a failure contracts it, the search stops
+ * when the step falls below the minimal step.
+ *
+ * With the ordering cache the successful direction is polled first in the
+ * following iterations, s.t. the opportunistic choice follows the recent
+ * descent directions.
+ */
+template<class Neighbor>
+class moPatternSearchExplorer : public moNeighborhoodExplorer<Neighbor>
+{
+public:
+
+  typedef typename Neighbor::EOT EOT;
+  typedef moNeighborhood<Neighbor> Neighborhood;
+
+  /**
+   * Cor
+   *
+   * @param _neighborhood the neighborhood (not used)
+   * @param _eval neighbor's evaluation function (not used)
+   * @param _fullEval thread-safe full evaluation function
+   * @param _step initial step
+   * @param _minStep minimal step for stopping
+   */
+  moPatternSearchExplorer(Neighborhood& _neighborhood,
+			  moEval<Neighbor>& _eval,
+			  eoEvalFunc<EOT>& _fullEval,
+			  double _step=1.0,
+			  double _minStep=1e-8)
+    : moNeighborhoodExplorer<Neighbor>(_neighborhood,_eval),fullEval(_fullEval),
+    initStep(_step),minStep(_minStep),expansion(2.0),contraction(0.5),
+    minimal(false),opportunistic(true),orderCache(false) { }
+
+  /**
+   * set the initial and the minimal step
+   */
+  void setSteps(double _step,double _minStep) {
+    initStep = _step;
+    minStep = _minStep;
+  }
+
+  /**
+   * set the expansion (>= 1) and the contraction (]0,1[) factors of the step
+   */
+  void setFactors(double _expansion,double _contraction) {
+    expansion = std::max(1.0,_expansion);
+    contraction = (_contraction > 0.0 && _contraction < 1.0) ? _contraction : 0.5;
+  }
+
+  /**
+   * set whether the minimal positive spanning set (n+1 directions) is polled instead of the compass (2n)
+   */
+  void setMinimalPollSet(bool _minimal) {
+    minimal = _minimal;
+  }
+
+  /**
+   * set whether the first improving poll point is taken instead of the best one
+   */
+  void setOpportunistic(bool _opportunistic) {
+    opportunistic = _opportunistic;
+  }
+
+  /**
+   * set whether successful directions are polled first in the following iterations
+   */
+  void setOrderCache(bool _orderCache) {
+    orderCache = _orderCache;
+  }
+
+  /**
+   * @return the current step
+   */
+  double getStep() const {
+    return step;
+  }
+
+  /**
+   * initialization of the poll set
+   * @param _solution the initial solution
+   */
+  virtual void initParam(EOT& _solution) {
+    n = _solution.size();
+    unsigned numDirs = minimal ? n + 1 : 2 * n;
+    dirs.assign(numDirs * n,0.0);
+    for(unsigned i=0;i<n;i++) {
+      dirs[i*n+i] = 1.0;
+      if(minimal)
+	dirs[n*n+i] = -1.0 / std::sqrt((double) n);
+      else
+	dirs[(n+i)*n+i] = -1.0;
+    }
+    order.resize(numDirs);
+    for(unsigned k=0;k<numDirs;k++) order[k] = k;
+    pattern.assign(n,0.0);
+    hasPattern = false;
+    step = initStep;
+    improved = false;
+    converged = step < minStep;
+  }
+
+  /// nothing to update
+  virtual void updateParam(EOT& _solution) { }
+
+  /// nothing to terminate
+  virtual void terminate(EOT& _solution) { }
+
+  /**
+   * evaluate the poll set (and the pattern point) concurrently
+   * @param _solution the current solution
+   */
+  virtual void operator()(EOT& _solution) {
+    improved = false;
+    unsigned numDirs = order.size();
+    unsigned first = hasPattern ? 1 : 0;
+    points.resize(first + numDirs,_solution);
+    if(hasPattern) {
+      points[0] = _solution;
+      for(unsigned i=0;i<n;i++) points[0][i] += pattern[i];
+      points[0].invalidate();
+    }
+    for(unsigned k=0;k<numDirs;k++) {
+      const double* d = &dirs[order[k]*n];
+      EOT& p = points[first+k];
+      p = _solution;
+      for(unsigned i=0;i<n;i++) p[i] += step * d[i];
+      p.invalidate();
+    }
+    ParallelEval::evaluate(points,fullEval);
+    int best = -1;
+    for(unsigned k=0;k<points.size();k++) {
+      if(points[k].fitness() > (best < 0 ? _solution.fitness() : points[best].fitness())) {
+	best = k;
+	if(opportunistic) break;
+      }
+    }
+    if(best < 0) {
+      step *= contraction;
+      hasPattern = false;
+      if(step < minStep) converged = true;
+      return;
+    }
+    improved = true;
+    candidate = points[best];
+    for(unsigned i=0;i<n;i++) pattern[i] = (double) candidate[i] - (double) _solution[i];
+    hasPattern = true;
+    // successful poll direction first
+    if(orderCache && best >= (int) first) {
+      unsigned k = best - first;
+      unsigned dk = order[k];
+      for(;k>0;k--) order[k] = order[k-1];
+      order[0] = dk;
+    }
+    step *= expansion;
+  }
+
+  /**
+   * @return whether an improving poll point is found
+   */
+  virtual bool accept(EOT& _solution) {
+    return improved;
+  }
+
+  /**
+   * move to the improving poll point
+   */
+  virtual void move(EOT& _solution) {
+    _solution = candidate;
+  }
+
+  /**
+   * @return false if the step falls below the minimal step
+   */
+  virtual bool isContinue(EOT& _solution) {
+    return !converged;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return "moPatternSearchExplorer";
+  }
+
+ protected:
+
+  /// thread-safe full evaluation function
+  eoEvalFunc<EOT>& fullEval;
+
+  /// initial step
+  double initStep;
+
+  /// minimal step
+  double minStep;
+
+  /// expansion and contraction factors of the step
+  double expansion,contraction;
+
+  /// whether the minimal positive spanning set is polled
+  bool minimal;
+
+  /// whether the first improving point is taken
+  bool opportunistic;
+
+  /// whether successful directions are polled first
+  bool orderCache;
+
+  /// dimension
+  unsigned int n;
+
+  /// current step
+  double step;
+
+  /// poll directions (row-wise)
+  std::vector<double> dirs;
+
+  /// poll order of the directions
+  std::vector<unsigned int> order;
+
+  /// last successful step (pattern move)
+  std::vector<double> pattern;
+
+  /// whether the pattern point is polled
+  bool hasPattern;
+
+  /// points evaluated concurrently
+  std::vector<EOT> points;
+
+  /// improving poll point
+  EOT candidate;
+
+  /// whether an improving poll point is found
+  bool improved;
+
+  /// whether the step fell below the minimal step
+  bool converged;
+};
+
+
+/**
+ * \class moPatternSearch
+ *
+ * Generalized pattern search (Hooke-Jeeves / GPS) with concurrent polling
+ */
+template<class Neighbor>
+class moPatternSearch : public moLocalSearch<Neighbor>
+{
+public:
+
+  typedef typename Neighbor::EOT EOT;
+  typedef moNeighborhood<Neighbor> Neighborhood ;
+
+  /**
+   * Basic constructor for a pattern search
+   * @param _neighborhood the neighborhood (not used)
+   * @param _fullEval the full evaluation function, thread-safe
+   * @param _eval neighbor's evaluation function (not used)
+   * @param _step initial step
+   * @param _minStep minimal step for stopping
+   */
+  moPatternSearch(Neighborhood& _neighborhood,
+		  eoEvalFunc<EOT>& _fullEval,
+		  moEval<Neighbor>& _eval,
+		  double _step=1.0,
+		  double _minStep=1e-8)
+    : moLocalSearch<Neighbor>(explorer,trueCont,_fullEval),
+    explorer(_neighborhood,_eval,_fullEval,_step,_minStep)
+    {}
+
+  /**
+   * @return the pattern search explorer for setting its parameters
+   */
+  moPatternSearchExplorer<Neighbor>& getExplorer() {
+    return explorer;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return std::string("moPatternSearch");
+  }
+
+ private:
+
+  /// default continuator
+  moTrueContinuator<Neighbor> trueCont;
+
+  /// the pattern search explorer
+  moPatternSearchExplorer<Neighbor> explorer;
+};
+
+#endif
@@ -0,0 +1,543 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+ * \file moQuasiNewton.h
+ *
+ * @date   : Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+#ifndef _moQuasiNewton_h
+#define _moQuasiNewton_h
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "algo/moLocalSearch.h"
+#include "explorer/moNeighborhoodExplorer.h"
+#include "continuator/moTrueContinuator.h"
+
+#include "util/LinearAlgebra.h"
+#include "util/ParallelEval.h"
+
+/**
+ * \class moQuasiNewtonExplorer
+ *
+ * Explorer of a quasi-Newton method (BFGS or L-BFGS) with finite difference
+ * gradients. Each step consists of
+ * - a forward (n evaluations) or central (2n evaluations) difference gradient,
+ *   all perturbed points are evaluated concurrently
+ * - a bracketing line search along the quasi-Newton direction, each bracket
+ *   of trial steps is evaluated concurrently
+ *
+ * The full evaluation function is called from several threads,
+ * @see eoParallelEvalFuncCounter
+ *
+ * If an objective providing gradients is set (@see setGradient(), e.g.
+ * eoADObjFunc), they replace the finite differences.
+ */
+template<class Neighbor,class ObjFunc>
+class moQuasiNewtonExplorer : public moNeighborhoodExplorer<Neighbor>
+{
+public:
+
+  typedef typename Neighbor::EOT EOT;
+  typedef moNeighborhood<Neighbor> Neighborhood;
+
+  /**
+   * Cor
+   *
+   * @param _neighborhood the neighborhood (not used)
+   * @param _eval neighbor's evaluation function (not used)
+   * @param _fullEval thread-safe full evaluation function
+   * @param _memory number of correction pairs of L-BFGS, 0 for BFGS
+   * @param _central whether central differences are used
+   * @param _fdStep relative finite difference step, 0 for default
+   */
+  moQuasiNewtonExplorer(Neighborhood& _neighborhood,
+			moEval<Neighbor>& _eval,
+			eoEvalFunc<EOT>& _fullEval,
+			unsigned int _memory=0,
+			bool _central=false,
+			double _fdStep=0.0)
+    : moNeighborhoodExplorer<Neighbor>(_neighborhood,_eval),fullEval(_fullEval),
+    memory(_memory),central(_central),fdStep(_fdStep),gradTol(1e-8),
+    fTol(1e-14),numTrials(std::max(4,ParallelEval::numThreads())),armijo(1e-4),objective(0),counter(0) { }
+
+  /**
+   * use the gradients of the objective function instead of finite differences,
+   * each pass of the gradient computation is counted as one evaluation
+   *
+   * @param _objective objective function (0: finite differences)
+   * @param _counter counter of the objective function evaluations
+   */
+  void setGradient(ObjFunc* _objective,eoEvalFuncCounter<EOT>& _counter) {
+    objective = _objective;
+    counter = &_counter;
+  }
+
+  /**
+   * set the number of correction pairs (0: full BFGS)
+   */
+  void setMemory(unsigned int _memory) {
+    memory = _memory;
+  }
+
+  /**
+   * set whether central (2n evaluations) or forward (n evaluations) differences are used
+   */
+  void setCentralDifferences(bool _central) {
+    central = _central;
+  }
+
+  /**
+   * set relative step of the finite difference, h_i = fdStep * max(1,|x_i|)
+   */
+  void setFDStep(double _fdStep) {
+    fdStep = _fdStep;
+  }
+
+  /**
+   * set tolerance of the gradient norm for stopping
+   */
+  void setGradTol(double _gradTol) {
+    gradTol = _gradTol;
+  }
+
+  /**
+   * set tolerance of the relative decrease of the objective, the search stops
+   * after three consecutive steps with a smaller decrease
+   */
+  void setFTol(double _fTol) {
+    fTol = _fTol;
+  }
+
+  /**
+   * set number of trial steps evaluated concurrently within a bracket of the line search
+   */
+  void setNumTrials(unsigned int _numTrials) {
+    numTrials = std::max(2u,_numTrials);
+  }
+
+  /**
+   * initialization of the quasi-Newton state
+   * @param _solution the initial solution
+   */
+  virtual void initParam(EOT& _solution) {
+    n = _solution.size();
+    g.assign(n,0.0);
+    gOld.assign(n,0.0);
+    d.assign(n,0.0);
+    s.assign(n,0.0);
+    y.assign(n,0.0);
+    sHist.clear();
+    yHist.clear();
+    resetHessian();
+    gradValid = false;
+    pending = false;
+    improved = false;
+    converged = false;
+    stall = 0;
+  }
+
+  /// nothing to update
+  virtual void updateParam(EOT& _solution) { }
+
+  /// nothing to terminate
+  virtual void terminate(EOT& _solution) { }
+
+  /**
+   * compute the gradient, the search direction and perform the line search
+   * @param _solution the current solution
+   */
+  virtual void operator()(EOT& _solution) {
+    improved = false;
+    if(!gradValid) {
+      gradient(_solution);
+      gradValid = true;
+      if(pending) {
+	for(unsigned i=0;i<n;i++) y[i] = g[i] - gOld[i];
+	update();
+	pending = false;
+      }
+    }
+    double gnorm = std::sqrt(LinearAlgebra::dot(&g[0],&g[0],n));
+    if(gnorm < gradTol) {
+      converged = true;
+      return;
+    }
+    direction();
+    double slope = LinearAlgebra::dot(&d[0],&g[0],n);
+    if(slope >= 0.0) {
+      resetHessian();
+      direction();
+      slope = LinearAlgebra::dot(&d[0],&g[0],n);
+    }
+    // initial steepest descent step is normalized
+    double alpha0 = identity ? std::min(1.0,1.0/gnorm) : 1.0;
+    lineSearch(_solution,alpha0,slope);
+  }
+
+  /**
+   * @return whether the line search found a better solution
+   */
+  virtual bool accept(EOT& _solution) {
+    return improved;
+  }
+
+  /**
+   * move to the solution found by the line search
+   */
+  virtual void move(EOT& _solution) {
+    for(unsigned i=0;i<n;i++) s[i] = candidate[i] - _solution[i];
+    gOld = g;
+    pending = true;
+    gradValid = false;
+    _solution = candidate;
+  }
+
+  /**
+   * @return false if the gradient vanishes or no descent step is found along the steepest descent
+   */
+  virtual bool isContinue(EOT& _solution) {
+    if(converged) return false;
+    if(!improved) {
+      if(identity) return false;
+      // retry along the steepest descent
+      resetHessian();
+    }
+    return true;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return "moQuasiNewtonExplorer";
+  }
+
+ protected:
+
+  /**
+   * gradient at _solution, by the objective function if it provides one, otherwise
+   * by finite differences with all perturbed points evaluated concurrently
+   */
+  void gradient(EOT& _solution) {
+    if(objective != 0) {
+      double f;
+      unsigned passes = objective->gradient(_solution,g,f);
+      if(passes > 0) {
+	__sync_fetch_and_add(&(counter->value()),(unsigned long) passes);
+	return;
+      }
+    }
+    double step = fdStep > 0.0 ? fdStep :
+      (central ? std::pow(std::numeric_limits<double>::epsilon(),1.0/3.0)
+               : std::sqrt(std::numeric_limits<double>::epsilon()));
+    unsigned npts = central ? 2*n : n;
+    points.resize(npts,_solution);
+    h.resize(n);
+    for(unsigned i=0;i<n;i++) {
+      h[i] = step * std::max(1.0,std::fabs((double) _solution[i]));
+      points[i] = _solution;
+      points[i][i] += h[i];
+      points[i].invalidate();
+      if(central) {
+	points[n+i] = _solution;
+	points[n+i][i] -= h[i];
+	points[n+i].invalidate();
+      }
+    }
+    ParallelEval::evaluate(points,fullEval);
+    double f0 = _solution.fitness();
+    for(unsigned i=0;i<n;i++) {
+      double fp = points[i].fitness();
+      if(central) {
+	double fm = points[n+i].fitness();
+	g[i] = (fp - fm) / (2.0 * h[i]);
+      } else
+	g[i] = (fp - f0) / h[i];
+    }
+  }
+
+  /**
+   * d = -H g (BFGS) or two-loop recursion (L-BFGS)
+   */
+  void direction() {
+    if(memory == 0) {
+      LinearAlgebra::multAx(&H[0],&g[0],&d[0],n,n);
+      for(unsigned i=0;i<n;i++) d[i] = -d[i];
+      return;
+    }
+    // L-BFGS two-loop recursion
+    unsigned m = sHist.size();
+    std::vector<double> a(m);
+    for(unsigned i=0;i<n;i++) d[i] = -g[i];
+    for(int k=m-1;k>=0;k--) {
+      a[k] = rhoHist[k] * LinearAlgebra::dot(&sHist[k][0],&d[0],n);
+      for(unsigned i=0;i<n;i++) d[i] -= a[k] * yHist[k][i];
+    }
+    for(unsigned i=0;i<n;i++) d[i] *= gamma;
+    for(unsigned k=0;k<m;k++) {
+      double b = rhoHist[k] * LinearAlgebra::dot(&yHist[k][0],&d[0],n);
+      for(unsigned i=0;i<n;i++) d[i] += (a[k] - b) * sHist[k][i];
+    }
+  }
+
+  /**
+   * BFGS / L-BFGS update with the pair (s,y), skipped if the curvature condition fails
+   */
+  void update() {
+    double sy = LinearAlgebra::dot(&s[0],&y[0],n);
+    double yy = LinearAlgebra::dot(&y[0],&y[0],n);
+    double ss = LinearAlgebra::dot(&s[0],&s[0],n);
+    if(sy <= 1e-10 * std::sqrt(ss * yy)) return;
+    double rho = 1.0 / sy;
+    if(memory > 0) {
+      if(sHist.size() == memory) {
+	sHist.erase(sHist.begin());
+	yHist.erase(yHist.begin());
+	rhoHist.erase(rhoHist.begin());
+      }
+      sHist.push_back(s);
+      yHist.push_back(y);
+      rhoHist.push_back(rho);
+      gamma = sy / yy;
+      identity = false;
+      return;
+    }
+    if(identity) {
+      // scale the initial approximation before the first update
+      for(unsigned i=0;i<n*n;i++) H[i] *= sy / yy;
+    }
+    std::vector<double> Hy(n);
+    LinearAlgebra::multAx(&H[0],&y[0],&Hy[0],n,n);
+    double yHy = LinearAlgebra::dot(&y[0],&Hy[0],n);
+    double c = (1.0 + rho * yHy) * rho;
+    for(unsigned i=0;i<n;i++) {
+      double* hi = &H[i*n];
+      for(unsigned j=0;j<n;j++)
+	hi[j] += c * s[i] * s[j] - rho * (Hy[i] * s[j] + s[i] * Hy[j]);
+    }
+    identity = false;
+  }
+
+  /**
+   * reset the Hessian approximation to the identity
+   */
+  void resetHessian() {
+    if(memory == 0) {
+      H.assign(n*n,0.0);
+      for(unsigned i=0;i<n;i++) H[i*n+i] = 1.0;
+    }
+    sHist.clear();
+    yHist.clear();
+    rhoHist.clear();
+    gamma = 1.0;
+    identity = true;
+  }
+
+  /**
+   * bracketing line search, each bracket of numTrials steps is evaluated concurrently.
+   * Brackets are shrunk until a step satisfies the Armijo condition and expanded
+   * while the largest step of the bracket is the best one.
+   */
+  void lineSearch(EOT& _solution,double _alpha0,double _slope) {
+    const double beta = 0.5;
+    double f0 = _solution.fitness();
+    double alpha = _alpha0;
+    double bestf = f0, besta = 0.0;
+    // shrinking brackets
+    for(int b=0;b<20 && besta == 0.0;b++) {
+      evalBracket(_solution,alpha,beta,f0,_slope,bestf,besta);
+      if(besta == 0.0) alpha *= std::pow(beta,(double) numTrials);
+    }
+    // expanding brackets
+    for(int b=0;b<10 && besta == alpha;b++) {
+      alpha = alpha / std::pow(beta,(double) numTrials);
+      evalBracket(_solution,alpha,beta,f0,_slope,bestf,besta);
+    }
+    if(besta > 0.0 && bestf < f0) {
+      improved = true;
+      candidate = _solution;
+      for(unsigned i=0;i<n;i++) candidate[i] += besta * d[i];
+      candidate.fitness(bestf);
+      stall = (f0 - bestf <= fTol * std::fabs(f0)) ? stall + 1 : 0;
+      if(stall >= 3) converged = true;
+    }
+  }
+
+  /**
+   * evaluate the trial steps alpha * beta^k, k = 0 ... numTrials-1, concurrently
+   */
+  void evalBracket(EOT& _solution,double _alpha,double _beta,double _f0,double _slope,double& _bestf,double& _besta) {
+    points.resize(numTrials,_solution);
+    std::vector<double> alphas(numTrials);
+    for(unsigned k=0;k<numTrials;k++) {
+      alphas[k] = _alpha * std::pow(_beta,(double) k);
+      points[k] = _solution;
+      for(unsigned i=0;i<n;i++) points[k][i] += alphas[k] * d[i];
+      points[k].invalidate();
+    }
+    ParallelEval::evaluate(points,fullEval);
+    for(unsigned k=0;k<numTrials;k++) {
+      double f = points[k].fitness();
+      if(f <= _f0 + armijo * alphas[k] * _slope && f < _bestf) {
+	_bestf = f;
+	_besta = alphas[k];
+      }
+    }
+  }
+
+  /// thread-safe full evaluation function
+  eoEvalFunc<EOT>& fullEval;
+
+  /// number of correction pairs of L-BFGS (0: BFGS)
+  unsigned int memory;
+
+  /// whether central differences are used
+  bool central;
+
+  /// relative finite difference step
+  double fdStep;
+
+  /// tolerance of the gradient norm
+  double gradTol;
+
+  /// tolerance of the relative decrease of the objective
+  double fTol;
+
+  /// number of consecutive steps with a decrease below fTol
+  unsigned int stall;
+
+  /// number of concurrent trial steps of a bracket
+  unsigned int numTrials;
+
+  /// constant of the Armijo condition
+  double armijo;
+
+  /// dimension
+  unsigned int n;
+
+  /// gradient, previous gradient, search direction, step, gradient change, fd steps
+  std::vector<double> g,gOld,d,s,y,h;
+
+  /// inverse Hessian approximation (BFGS)
+  std::vector<double> H;
+
+  /// correction pairs (L-BFGS)
+  std::vector<std::vector<double> > sHist,yHist;
+
+  /// 1/(s^T y) of the correction pairs (L-BFGS)
+  std::vector<double> rhoHist;
+
+  /// scaling of the initial inverse Hessian (L-BFGS)
+  double gamma;
+
+  /// points evaluated concurrently
+  std::vector<EOT> points;
+
+  /// solution found by the line search
+  EOT candidate;
+
+  /// whether the Hessian approximation is the identity
+  bool identity;
+
+  /// whether the gradient of the current solution is computed
+  bool gradValid;
+
+  /// whether an update with the last step is pending
+  bool pending;
+
+  /// whether the line search found a better solution
+  bool improved;
+
+  /// whether the gradient vanishes
+  bool converged;
+
+  /// objective function providing gradients (0: finite differences)
+  ObjFunc* objective;
+
+  /// counter of the objective function evaluations
+  eoEvalFuncCounter<EOT>* counter;
+};
+
+
+/**
+ * \class moQuasiNewton
+ *
+ * Quasi-Newton local search (BFGS / L-BFGS) with finite difference or
+ * analytic gradients
+ */
+template<class Neighbor,class ObjFunc>
+class moQuasiNewton : public moLocalSearch<Neighbor>
+{
+public:
+
+  typedef typename Neighbor::EOT EOT;
+  typedef moNeighborhood<Neighbor> Neighborhood ;
+
+  /**
+   * Basic constructor for a quasi-Newton method
+   * @param _neighborhood the neighborhood (not used)
+   * @param _fullEval the full evaluation function, thread-safe
+   * @param _eval neighbor's evaluation function (not used)
+   * @param _memory number of correction pairs of L-BFGS, 0 for BFGS
+   * @param _central whether central differences are used
+   */
+  moQuasiNewton(Neighborhood& _neighborhood,
+		eoEvalFunc<EOT>& _fullEval,
+		moEval<Neighbor>& _eval,
+		unsigned int _memory=0,
+		bool _central=false)
+    : moLocalSearch<Neighbor>(explorer,trueCont,_fullEval),
+    explorer(_neighborhood,_eval,_fullEval,_memory,_central)
+    {}
+
+  /**
+   * @return the quasi-Newton explorer for setting its parameters
+   */
+  moQuasiNewtonExplorer<Neighbor,ObjFunc>& getExplorer() {
+    return explorer;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return std::string("moQuasiNewton");
+  }
+
+ private:
+
+  /// default continuator
+  moTrueContinuator<Neighbor> trueCont;
+
+  /// the quasi-Newton explorer
+  moQuasiNewtonExplorer<Neighbor,ObjFunc> explorer;
+};
+
+#endif
@@ -0,0 +1,294 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+ * \file moSPSA.h
+ *
+ * @date   : Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+#ifndef _moSPSA_h
+#define _moSPSA_h
+
+#include <vector>
+#include <cmath>
+
+#include "algo/moLocalSearch.h"
+#include "explorer/moNeighborhoodExplorer.h"
+#include "continuator/moTrueContinuator.h"
+
+#include "util/ParallelEval.h"
+
+/**
+ * \class moSPSAExplorer
+ *
+ * Explorer of the simultaneous perturbation stochastic approximation (SPSA).
+ * The gradient is estimated from 2 evaluations at x +- c_k * delta with a
+ * random Bernoulli +-1 vector delta, independently of the dimension.
+ * Optionally the estimate is averaged over several perturbations, all
+ * 2 * numAverages points are evaluated concurrently.
+ *
+ * Gain sequences : a_k = a / (k + 1 + A)^alpha , c_k = c / (k + 1)^gamma
+ *
+ * An iteration costs 2 * numAverages evaluations: the new iterate is not 
+ * evaluated, its fitness is the mean of the perturbed values (exact up to 
+ * O(c_k^2)). With setEvalIterate(true) it is evaluated (one more evaluation). 
+ * SPSA is not monotone, the best visited solution (the initial one, the 
+ * perturbed points and the evaluated iterates) is restored at termination.
+ */
+template<class Neighbor>
+class moSPSAExplorer : public moNeighborhoodExplorer<Neighbor>
+{
+public:
+
+  typedef typename Neighbor::EOT EOT;
+  typedef moNeighborhood<Neighbor> Neighborhood;
+
+  /**
+   * Cor
+   *
+   * @param _neighborhood the neighborhood (not used)
+   * @param _eval neighbor's evaluation function (not used)
+   * @param _fullEval thread-safe full evaluation function
+   * @param _numAverages number of averaged gradient estimates per iteration
+   */
+  moSPSAExplorer(Neighborhood& _neighborhood,
+		 moEval<Neighbor>& _eval,
+		 eoEvalFunc<EOT>& _fullEval,
+		 unsigned int _numAverages=1)
+    : moNeighborhoodExplorer<Neighbor>(_neighborhood,_eval),fullEval(_fullEval),
+    numAverages(_numAverages > 0 ? _numAverages : 1),a(0.1),c(0.1),A(10.0),alpha(0.602),gamma(0.101),evalIterate(false) { }
+
+  /**
+   * set the gain sequences a_k = a / (k + 1 + A)^alpha , c_k = c / (k + 1)^gamma
+   */
+  void setGains(double _a,double _c,double _A=10.0,double _alpha=0.602,double _gamma=0.101) {
+    a = _a;
+    c = _c;
+    A = _A;
+    alpha = _alpha;
+    gamma = _gamma;
+  }
+
+  /**
+   * set the number of averaged gradient estimates per iteration, 
+   * each costs 2 evaluations
+   */
+  void setNumAverages(unsigned int _numAverages) {
+    numAverages = _numAverages > 0 ? _numAverages : 1;
+  }
+
+  /**
+   * evaluate each new iterate (one more evaluation per iteration) 
+   * instead of estimating its fitness from the perturbed points 
+   */
+  void setEvalIterate(bool _evalIterate) {
+    evalIterate = _evalIterate;
+  }
+
+  /**
+   * initialization
+   * @param _solution the initial solution
+   */
+  virtual void initParam(EOT& _solution) {
+    n = _solution.size();
+    k = 0;
+    ghat.assign(n,0.0);
+    delta.assign(numAverages*n,0.0);
+    points.resize(2*numAverages,_solution);
+    best = _solution;
+  }
+
+  /// increase the iteration counter
+  virtual void updateParam(EOT& _solution) {
+    k++;
+  }
+
+  /// restore the best visited solution, an estimated iterate is discarded
+  virtual void terminate(EOT& _solution) {
+    if(!evalIterate || best.fitness() > _solution.fitness())
+      _solution = best;
+  }
+
+  /**
+   * estimate the gradient and perform the step
+   * @param _solution the current solution
+   */
+  virtual void operator()(EOT& _solution) {
+    double ak = a / std::pow(k + 1.0 + A,alpha);
+    double ck = c / std::pow(k + 1.0,gamma);
+    for(unsigned r=0;r<numAverages;r++) {
+      double* dr = &delta[r*n];
+      points[2*r] = _solution;
+      points[2*r+1] = _solution;
+      for(unsigned i=0;i<n;i++) {
+	dr[i] = rng.flip() ? 1.0 : -1.0;
+	points[2*r][i] += ck * dr[i];
+	points[2*r+1][i] -= ck * dr[i];
+      }
+      points[2*r].invalidate();
+      points[2*r+1].invalidate();
+    }
+    ParallelEval::evaluate(points,fullEval);
+    for(unsigned i=0;i<n;i++) ghat[i] = 0.0;
+    double sum = 0.0;
+    for(unsigned r=0;r<numAverages;r++) {
+      double df = (double) points[2*r].fitness() - (double) points[2*r+1].fitness();
+      const double* dr = &delta[r*n];
+      // 1/delta_i == delta_i for +-1 perturbations
+      for(unsigned i=0;i<n;i++) ghat[i] += df / (2.0 * ck) * dr[i];
+      sum += (double) points[2*r].fitness() + (double) points[2*r+1].fitness();
+      // the perturbed points are visited solutions
+      for(unsigned j=2*r;j<2*r+2;j++) 
+	if(points[j].fitness() > best.fitness())
+	  best = points[j];
+    }
+    candidate = _solution;
+    for(unsigned i=0;i<n;i++) candidate[i] -= ak * ghat[i] / numAverages;
+    candidate.invalidate();
+    if(evalIterate) 
+      fullEval(candidate);
+    else 
+      candidate.fitness(typename EOT::Fitness(sum / (2 * numAverages)));
+  }
+
+  /**
+   * SPSA always moves
+   */
+  virtual bool accept(EOT& _solution) {
+    return true;
+  }
+
+  /**
+   * move to the new iterate and remember the best visited solution
+   */
+  virtual void move(EOT& _solution) {
+    _solution = candidate;
+    if(evalIterate && candidate.fitness() > best.fitness())
+      best = candidate;
+  }
+
+  /**
+   * SPSA is stopped by the continuators only
+   */
+  virtual bool isContinue(EOT& _solution) {
+    return true;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return "moSPSAExplorer";
+  }
+
+ protected:
+
+  /// thread-safe full evaluation function
+  eoEvalFunc<EOT>& fullEval;
+
+  /// number of averaged gradient estimates
+  unsigned int numAverages;
+
+  /// gain sequence parameters
+  double a,c,A,alpha,gamma;
+
+  /// whether the new iterates are evaluated
+  bool evalIterate;
+
+  /// dimension
+  unsigned int n;
+
+  /// iteration counter
+  unsigned long k;
+
+  /// gradient estimate
+  std::vector<double> ghat;
+
+  /// perturbations (numAverages x n)
+  std::vector<double> delta;
+
+  /// perturbed points evaluated concurrently
+  std::vector<EOT> points;
+
+  /// new iterate
+  EOT candidate;
+
+  /// best visited solution
+  EOT best;
+};
+
+
+/**
+ * \class moSPSA
+ *
+ * Simultaneous perturbation stochastic approximation local search
+ */
+template<class Neighbor>
+class moSPSA : public moLocalSearch<Neighbor>
+{
+public:
+
+  typedef typename Neighbor::EOT EOT;
+  typedef moNeighborhood<Neighbor> Neighborhood ;
+
+  /**
+   * Basic constructor for SPSA
+   * @param _neighborhood the neighborhood (not used)
+   * @param _fullEval the full evaluation function, thread-safe
+   * @param _eval neighbor's evaluation function (not used)
+   * @param _numAverages number of averaged gradient estimates per iteration
+   */
+  moSPSA(Neighborhood& _neighborhood,
+	 eoEvalFunc<EOT>& _fullEval,
+	 moEval<Neighbor>& _eval,
+	 unsigned int _numAverages=1)
+    : moLocalSearch<Neighbor>(explorer,trueCont,_fullEval),
+    explorer(_neighborhood,_eval,_fullEval,_numAverages)
+    {}
+
+  /**
+   * @return the SPSA explorer for setting its parameters
+   */
+  moSPSAExplorer<Neighbor>& getExplorer() {
+    return explorer;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return std::string("moSPSA");
+  }
+
+ private:
+
+  /// default continuator
+  moTrueContinuator<Neighbor> trueCont;
+
+  /// the SPSA explorer
+  moSPSAExplorer<Neighbor> explorer;
+};
+
+#endif
@@ -0,0 +1,645 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+ * \file moTrustRegion.h
+ *
+ * @date   : Oct. 2026
+ * last changes : Oct. 2026
+ */
+
+#ifndef _moTrustRegion_h
+#define _moTrustRegion_h
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "algo/moLocalSearch.h"
+#include "explorer/moNeighborhoodExplorer.h"
+#include "continuator/moTrueContinuator.h"
+
+#include "util/LinearAlgebra.h"
+#include "util/ParallelEval.h"
+
+/**
+ * \class moTrustRegionExplorer
+ *
+ * Explorer of a bound constrained derivative-free trust region method in the
+ * spirit of Powell's BOBYQA. A quadratic model interpolates the objective at
+ * m = 2n+1 points; each time a point is replaced the model changes by the
+ * quadratic of least Frobenius norm of its Hessian which restores the
+ * interpolation conditions, s.t. an iteration normally costs a single
+ * evaluation. The step minimizes the model within the trust region and the
+ * bounds (truncated conjugate gradients, active bounds are fixed).
+ *
+ * If the model is not reliable, the farthest interpolation points are moved
+ * into the trust region to maximize their Lagrange functions (geometry
+ * steps), up to numGeometry points are evaluated concurrently. The trust
+ * region radius is bounded below by the resolution rho which decreases from
+ * the initial to the final radius.
+ *
+ * With bounds the variables are scaled to [0,1], the bounds are never
+ * violated and both radii are relative to the bounds.
+ */
+template<class Neighbor>
+class moTrustRegionExplorer : public moNeighborhoodExplorer<Neighbor>
+{
+public:
+
+  typedef typename Neighbor::EOT EOT;
+  typedef moNeighborhood<Neighbor> Neighborhood;
+
+  /**
+   * Cor
+   *
+   * @param _neighborhood the neighborhood (not used)
+   * @param _eval neighbor's evaluation function (not used)
+   * @param _fullEval thread-safe full evaluation function
+   * @param _initRadius initial trust region radius
+   * @param _endRadius final trust region radius
+   */
+  moTrustRegionExplorer(Neighborhood& _neighborhood,
+			moEval<Neighbor>& _eval,
+			eoEvalFunc<EOT>& _fullEval,
+			double _initRadius=0.1,
+			double _endRadius=1e-8)
+    : moNeighborhoodExplorer<Neighbor>(_neighborhood,_eval),fullEval(_fullEval),
+    initRadius(_initRadius),endRadius(_endRadius),numGeometry(1) { }
+
+  /**
+   * set the bounds, hard constraints of all evaluated points (empty: unbounded)
+   */
+  void setBounds(const std::vector<double>& _lowerBound,const std::vector<double>& _upperBound) {
+    lowerBound = _lowerBound;
+    upperBound = _upperBound;
+  }
+
+  /**
+   * set the initial and the final trust region radius
+   */
+  void setRadii(double _initRadius,double _endRadius) {
+    initRadius = _initRadius;
+    endRadius = _endRadius;
+  }
+
+  /**
+   * set the max. number of geometry improving points evaluated concurrently
+   */
+  void setNumGeometry(unsigned int _numGeometry) {
+    numGeometry = std::max(1u,_numGeometry);
+  }
+
+  /**
+   * @return current trust region radius (scaled)
+   */
+  double getRadius() const {
+    return delta;
+  }
+
+  /**
+   * initialization of the interpolation set x0, x0 +- rho e_i
+   * @param _solution the initial solution
+   */
+  virtual void initParam(EOT& _solution) {
+    n = _solution.size();
+    m = 2 * n + 1;
+    bounded = lowerBound.size() == n && upperBound.size() == n;
+    lo.assign(n,-HUGE_VAL);
+    hi.assign(n,HUGE_VAL);
+    rho = initRadius;
+    if(bounded) {
+      for(unsigned i=0;i<n;i++) {
+	lo[i] = 0.0;
+	hi[i] = upperBound[i] > lowerBound[i] ? 1.0 : 0.0;
+      }
+      rho = std::min(rho,0.5);
+    }
+    delta = rho;
+    converged = improved = false;
+    // the initial point is moved inside s.t. the interpolation points are feasible
+    std::vector<double> z0(n);
+    toUnit(_solution,&z0[0]);
+    bool shifted = false;
+    for(unsigned i=0;i<n;i++)
+      if(hi[i] - lo[i] >= 2.0 * rho && (z0[i] < lo[i] + rho || z0[i] > hi[i] - rho)) {
+	z0[i] = std::min(std::max(z0[i],lo[i] + rho),hi[i] - rho);
+	shifted = true;
+      }
+    points.assign(m,_solution);
+    Z.assign(m * n,0.0);
+    F.assign(m,0.0);
+    for(unsigned j=0;j<m;j++) {
+      double* z = &Z[j*n];
+      std::copy(z0.begin(),z0.end(),z);
+      if(j > 0) {
+	unsigned i = (j - 1) % n;
+	z[i] += (j <= n ? rho : -rho);
+	z[i] = std::min(std::max(z[i],lo[i]),hi[i]);
+      }
+      fromUnit(z,points[j]);
+    }
+    if(!shifted) points[0] = _solution;
+    ParallelEval::evaluate(points,fullEval);
+    k = 0;
+    for(unsigned j=0;j<m;j++) {
+      F[j] = points[j].fitness();
+      if(F[j] < F[k]) k = j;
+    }
+    // model interpolating the initial points
+    zc.assign(Z.begin() + k*n,Z.begin() + (k+1)*n);
+    cQ = 0.0;
+    gQ.assign(n,0.0);
+    HQ.assign(n * n,0.0);
+    if(!factorize() || !fit()) converged = true;
+    checkImprovement(_solution);
+  }
+
+  /// nothing to update
+  virtual void updateParam(EOT& _solution) { }
+
+  /// nothing to terminate
+  virtual void terminate(EOT& _solution) { }
+
+  /**
+   * one trust region iteration
+   * @param _solution the current solution
+   */
+  virtual void operator()(EOT& _solution) {
+    improved = false;
+    std::vector<double> d(n);
+    double reduction = trustRegionStep(d);
+    double dnorm = std::sqrt(LinearAlgebra::dot(&d[0],&d[0],n));
+    if(dnorm < 0.5 * rho || !(reduction > 0.0)) {
+      // the model is stationary at the current resolution
+      delta = std::max(0.5 * delta,rho);
+      if(!geometryStep()) reduceResolution();
+      checkImprovement(_solution);
+      return;
+    }
+    std::vector<double> z(n);
+    for(unsigned i=0;i<n;i++) z[i] = std::min(std::max(zc[i] + d[i],lo[i]),hi[i]);
+    EOT x(_solution);
+    fromUnit(&z[0],x);
+    fullEval(x);
+    double ratio = (F[k] - (double) x.fitness()) / reduction;
+    if(ratio <= 0.1)
+      delta = std::min(0.5 * delta,dnorm);
+    else if(ratio <= 0.7)
+      delta = std::max(0.5 * delta,dnorm);
+    else
+      delta = std::max(0.5 * delta,2.0 * dnorm);
+    if(delta <= 1.5 * rho) delta = rho;
+    // replace the point of largest weighted Lagrange function, not the current one if the step failed
+    std::vector<double> l(m);
+    lagrange(&z[0],&l[0]);
+    int t = -1;
+    double wmax = 0.0;
+    for(unsigned j=0;j<m;j++) {
+      if(j == k && ratio <= 0.0) continue;
+      double dist2 = 0.0;
+      for(unsigned i=0;i<n;i++) dist2 += (Z[j*n+i] - zc[i]) * (Z[j*n+i] - zc[i]);
+      double w = std::max(1.0,dist2 / (delta * delta));
+      w = std::fabs(l[j]) * w * w;
+      if(w > wmax) {
+	wmax = w;
+	t = j;
+      }
+    }
+    if(t >= 0) replace(t,&z[0],x);
+    if(ratio < 0.1 && !geometryStep() && delta <= rho)
+      reduceResolution();
+    checkImprovement(_solution);
+  }
+
+  /**
+   * @return whether the best interpolation point improved
+   */
+  virtual bool accept(EOT& _solution) {
+    return improved;
+  }
+
+  /**
+   * move to the best interpolation point
+   */
+  virtual void move(EOT& _solution) {
+    _solution = points[k];
+  }
+
+  /**
+   * @return false if the final radius is reached
+   */
+  virtual bool isContinue(EOT& _solution) {
+    return !converged;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return "moTrustRegionExplorer";
+  }
+
+ protected:
+
+  /**
+   * truncated conjugate gradients on the model within the trust region and the bounds
+   *
+   * @param _d step from the center
+   * @return predicted reduction
+   */
+  double trustRegionStep(std::vector<double>& _d) {
+    std::fill(_d.begin(),_d.end(),0.0);
+    std::vector<double> g(gQ), r(n), p(n), Hp(n);
+    std::vector<bool> fixed(n);
+    for(unsigned i=0;i<n;i++)
+      fixed[i] = (zc[i] <= lo[i] && g[i] > 0.0) || (zc[i] >= hi[i] && g[i] < 0.0) || lo[i] >= hi[i];
+    bool done = false;
+    for(unsigned outer=0;outer<=n && !done;outer++) {
+      // residual -(g + H d) on the free variables
+      LinearAlgebra::multAx(&HQ[0],&_d[0],&r[0],n,n);
+      for(unsigned i=0;i<n;i++) r[i] = fixed[i] ? 0.0 : -(gQ[i] + r[i]);
+      double rr = LinearAlgebra::dot(&r[0],&r[0],n);
+      double rr0 = rr;
+      if(rr <= 0.0) break;
+      p = r;
+      done = true;
+      for(unsigned iter=0;iter<n;iter++) {
+	LinearAlgebra::multAx(&HQ[0],&p[0],&Hp[0],n,n);
+	double curv = LinearAlgebra::dot(&p[0],&Hp[0],n);
+	double pp = LinearAlgebra::dot(&p[0],&p[0],n);
+	double dp = LinearAlgebra::dot(&_d[0],&p[0],n);
+	double dd = LinearAlgebra::dot(&_d[0],&_d[0],n);
+	double a = (-dp + std::sqrt(std::max(dp * dp + pp * (delta * delta - dd),0.0))) / pp;
+	int hit = 0;   // 0: trust region, 1: interior, 2: bound
+	if(curv > 0.0 && rr / curv < a) {
+	  a = rr / curv;
+	  hit = 1;
+	}
+	int ib = -1;
+	for(unsigned i=0;i<n;i++) {
+	  if(fixed[i] || p[i] == 0.0) continue;
+	  double ai = ((p[i] > 0.0 ? hi[i] : lo[i]) - zc[i] - _d[i]) / p[i];
+	  if(ai < a) {
+	    a = std::max(ai,0.0);
+	    ib = i;
+	    hit = 2;
+	  }
+	}
+	for(unsigned i=0;i<n;i++) _d[i] += a * p[i];
+	if(hit == 0) break;
+	if(hit == 2) {
+	  _d[ib] = (p[ib] > 0.0 ? hi[ib] : lo[ib]) - zc[ib];
+	  fixed[ib] = true;
+	  done = false;
+	  break;
+	}
+	for(unsigned i=0;i<n;i++) r[i] -= a * Hp[i];
+	double rrn = LinearAlgebra::dot(&r[0],&r[0],n);
+	if(rrn < 1e-20 * rr0) break;
+	for(unsigned i=0;i<n;i++) p[i] = r[i] + (rrn / rr) * p[i];
+	rr = rrn;
+      }
+    }
+    LinearAlgebra::multAx(&HQ[0],&_d[0],&Hp[0],n,n);
+    return -(LinearAlgebra::dot(&gQ[0],&_d[0],n) + 0.5 * LinearAlgebra::dot(&_d[0],&Hp[0],n));
+  }
+
+  /**
+   * move the interpolation points farther than 2 delta from the center into
+   * the trust region, the new points are evaluated concurrently
+   *
+   * @return false if all points are close
+   */
+  bool geometryStep() {
+    std::vector<std::pair<double,unsigned> > far;
+    for(unsigned j=0;j<m;j++) {
+      double dist2 = 0.0;
+      for(unsigned i=0;i<n;i++) dist2 += (Z[j*n+i] - zc[i]) * (Z[j*n+i] - zc[i]);
+      if(dist2 > 4.0 * delta * delta) far.push_back(std::make_pair(-dist2,j));
+    }
+    if(far.empty()) return false;
+    std::sort(far.begin(),far.end());
+    unsigned q = std::min<unsigned>(far.size(),numGeometry);
+    std::vector<EOT> x(q,points[k]);
+    std::vector<double> z(q * n);
+    for(unsigned s=0;s<q;s++) {
+      geometryPoint(far[s].second,&z[s*n]);
+      fromUnit(&z[s*n],x[s]);
+    }
+    ParallelEval::evaluate(x,fullEval);
+    for(unsigned s=0;s<q;s++)
+      replace(far[s].second,&z[s*n],x[s]);
+    return true;
+  }
+
+  /**
+   * a point within the trust region and the bounds of large |l_t|, among
+   * the steps along the gradient of l_t and the coordinates
+   */
+  void geometryPoint(unsigned _t,double* _z) {
+    // gradient of the Lagrange function at the base point
+    std::vector<double> grad(n), y(n), l(m);
+    for(unsigned i=0;i<n;i++) grad[i] = W[(m+1+i)*dim + _t];
+    double gnorm = std::sqrt(LinearAlgebra::dot(&grad[0],&grad[0],n));
+    double best = -1.0;
+    for(unsigned c=0;c<2*n+2;c++) {
+      double sgn = (c % 2) ? -1.0 : 1.0;
+      unsigned dir = c / 2;
+      for(unsigned i=0;i<n;i++) {
+	double di;
+	if(dir == n) di = gnorm > 0.0 ? sgn * delta * grad[i] / gnorm : 0.0;
+	else di = i == dir ? sgn * delta : 0.0;
+	y[i] = std::min(std::max(zc[i] + di,lo[i]),hi[i]);
+      }
+      lagrange(&y[0],&l[0]);
+      if(std::fabs(l[_t]) > best) {
+	best = std::fabs(l[_t]);
+	std::copy(y.begin(),y.end(),_z);
+      }
+    }
+  }
+
+  /// decrease the resolution, converged at the final radius
+  void reduceResolution() {
+    if(rho <= endRadius) {
+      converged = true;
+      return;
+    }
+    double ratio = rho / endRadius;
+    rho = ratio <= 16.0 ? endRadius : (ratio <= 250.0 ? std::sqrt(ratio) * endRadius : 0.1 * rho);
+    delta = std::max(0.5 * delta,rho);
+  }
+
+  /**
+   * replace the interpolation point _t and update the model by the least
+   * Frobenius norm change of its Hessian, the set is kept if it became singular
+   */
+  void replace(unsigned _t,const double* _z,const EOT& _x) {
+    std::vector<double> zold(Z.begin() + _t*n,Z.begin() + (_t+1)*n);
+    EOT xold = points[_t];
+    double fold = F[_t];
+    std::copy(_z,_z+n,&Z[_t*n]);
+    points[_t] = _x;
+    F[_t] = _x.fitness();
+    if(!factorize()) {
+      std::copy(zold.begin(),zold.end(),&Z[_t*n]);
+      points[_t] = xold;
+      F[_t] = fold;
+      factorize();
+      return;
+    }
+    fit();
+    if(F[_t] < F[k]) k = _t;
+    recenter();
+  }
+
+  /**
+   * inverse of the KKT matrix [A e S ; e^T 0 0 ; S^T 0 0] of the least
+   * Frobenius norm interpolation with s_j = (z_j - zc) / delta and
+   * A_ij = (s_i^T s_j)^2 / 2 (the points are scaled for the conditioning)
+   */
+  bool factorize() {
+    dim = m + n + 1;
+    base = zc;
+    sigma = delta;
+    S.resize(m * n);
+    for(unsigned j=0;j<m;j++)
+      for(unsigned i=0;i<n;i++) S[j*n+i] = (Z[j*n+i] - base[i]) / sigma;
+    W.assign(dim * dim,0.0);
+    for(unsigned a=0;a<m;a++) {
+      for(unsigned b=a;b<m;b++) {
+	double s = LinearAlgebra::dot(&S[a*n],&S[b*n],n);
+	W[a*dim+b] = W[b*dim+a] = 0.5 * s * s;
+      }
+      W[a*dim+m] = W[m*dim+a] = 1.0;
+      for(unsigned i=0;i<n;i++) W[a*dim+m+1+i] = W[(m+1+i)*dim+a] = S[a*n+i];
+    }
+    return LinearAlgebra::invert(dim,&W[0]);
+  }
+
+  /**
+   * values of the Lagrange functions at _z
+   */
+  void lagrange(const double* _z,double* _l) const {
+    std::vector<double> s(n), w(dim);
+    for(unsigned i=0;i<n;i++) s[i] = (_z[i] - base[i]) / sigma;
+    for(unsigned j=0;j<m;j++) {
+      double t = LinearAlgebra::dot(&S[j*n],&s[0],n);
+      w[j] = 0.5 * t * t;
+    }
+    w[m] = 1.0;
+    for(unsigned i=0;i<n;i++) w[m+1+i] = s[i];
+    for(unsigned j=0;j<m;j++) _l[j] = LinearAlgebra::dot(&W[j*dim],&w[0],dim);
+  }
+
+  /**
+   * add the least Frobenius norm correction interpolating the residuals
+   */
+  bool fit() {
+    std::vector<double> r(dim,0.0), sol(dim);
+    for(unsigned j=0;j<m;j++) r[j] = F[j] - model(&Z[j*n]);
+    LinearAlgebra::multAx(&W[0],&r[0],&sol[0],dim,dim);
+    // the correction in the coordinates around the base point
+    std::vector<double> dz(n);
+    for(unsigned i=0;i<n;i++) dz[i] = base[i] - zc[i];
+    std::vector<double> Hdz(n);
+    LinearAlgebra::multAx(&HQ[0],&dz[0],&Hdz[0],n,n);
+    // recenter the model at the base point
+    cQ += LinearAlgebra::dot(&gQ[0],&dz[0],n) + 0.5 * LinearAlgebra::dot(&dz[0],&Hdz[0],n);
+    for(unsigned i=0;i<n;i++) gQ[i] += Hdz[i];
+    zc = base;
+    cQ += sol[m];
+    for(unsigned i=0;i<n;i++) gQ[i] += sol[m+1+i] / sigma;
+    double s2 = sigma * sigma;
+    for(unsigned j=0;j<m;j++) {
+      double lj = sol[j] / s2;
+      const double* sj = &S[j*n];
+      for(unsigned a=0;a<n;a++)
+	for(unsigned b=0;b<n;b++) HQ[a*n+b] += lj * sj[a] * sj[b];
+    }
+    for(unsigned i=0;i<dim;i++)
+      if(!(sol[i] == sol[i])) return false;
+    return true;
+  }
+
+  /// model value at _z
+  double model(const double* _z) const {
+    std::vector<double> d(n), Hd(n);
+    for(unsigned i=0;i<n;i++) d[i] = _z[i] - zc[i];
+    LinearAlgebra::multAx(&HQ[0],&d[0],&Hd[0],n,n);
+    return cQ + LinearAlgebra::dot(&gQ[0],&d[0],n) + 0.5 * LinearAlgebra::dot(&d[0],&Hd[0],n);
+  }
+
+  /// move the center of the model to the best point
+  void recenter() {
+    std::vector<double> d(n), Hd(n);
+    for(unsigned i=0;i<n;i++) d[i] = Z[k*n+i] - zc[i];
+    LinearAlgebra::multAx(&HQ[0],&d[0],&Hd[0],n,n);
+    cQ += LinearAlgebra::dot(&gQ[0],&d[0],n) + 0.5 * LinearAlgebra::dot(&d[0],&Hd[0],n);
+    for(unsigned i=0;i<n;i++) gQ[i] += Hd[i];
+    zc.assign(Z.begin() + k*n,Z.begin() + (k+1)*n);
+  }
+
+  /// whether the best point improves the solution
+  void checkImprovement(EOT& _solution) {
+    improved = F[k] < (double) _solution.fitness();
+  }
+
+  /// scale a solution into the unit box (if bounded)
+  void toUnit(const EOT& _x,double* _z) const {
+    for(unsigned i=0;i<n;i++) {
+      if(!bounded) _z[i] = _x[i];
+      else if(hi[i] > 0.0) _z[i] = ((double) _x[i] - lowerBound[i]) / (upperBound[i] - lowerBound[i]);
+      else _z[i] = 0.0;
+    }
+  }
+
+  /// scale a point of the unit box into the bounds (if bounded)
+  void fromUnit(const double* _z,EOT& _x) const {
+    for(unsigned i=0;i<n;i++)
+      _x[i] = bounded ? lowerBound[i] + _z[i] * (upperBound[i] - lowerBound[i]) : _z[i];
+    _x.invalidate();
+  }
+
+  /// thread-safe full evaluation function
+  eoEvalFunc<EOT>& fullEval;
+
+  /// initial trust region radius
+  double initRadius;
+
+  /// final trust region radius
+  double endRadius;
+
+  /// max. number of concurrent geometry improving points
+  unsigned int numGeometry;
+
+  /// bounds (empty: unbounded)
+  std::vector<double> lowerBound,upperBound;
+
+  /// whether the variables are scaled to the unit box
+  bool bounded;
+
+  /// scaled bounds
+  std::vector<double> lo,hi;
+
+  /// dimension and number of interpolation points
+  unsigned int n,m;
+
+  /// interpolation points as solutions
+  std::vector<EOT> points;
+
+  /// scaled interpolation points (m x n)
+  std::vector<double> Z;
+
+  /// objective values of the interpolation points
+  std::vector<double> F;
+
+  /// index of the best interpolation point
+  unsigned int k;
+
+  /// center of the model
+  std::vector<double> zc;
+
+  /// model value, gradient and Hessian at the center
+  double cQ;
+  std::vector<double> gQ,HQ;
+
+  /// trust region radius and resolution
+  double delta,rho;
+
+  /// dimension of the KKT matrix
+  unsigned int dim;
+
+  /// base point and scale of the KKT matrix
+  std::vector<double> base;
+  double sigma;
+
+  /// scaled interpolation points relative to the base point (m x n)
+  std::vector<double> S;
+
+  /// inverse of the KKT matrix
+  std::vector<double> W;
+
+  /// whether the best point improved the solution
+  bool improved;
+
+  /// whether the final radius is reached
+  bool converged;
+};
+
+
+/**
+ * \class moTrustRegion
+ *
+ * Derivative-free trust region method with quadratic interpolation models
+ */
+template<class Neighbor>
+class moTrustRegion : public moLocalSearch<Neighbor>
+{
+public:
+
+  typedef typename Neighbor::EOT EOT;
+  typedef moNeighborhood<Neighbor> Neighborhood ;
+
+  /**
+   * Basic constructor for the trust region method
+   * @param _neighborhood the neighborhood (not used)
+   * @param _fullEval the full evaluation function, thread-safe
+   * @param _eval neighbor's evaluation function (not used)
+   * @param _initRadius initial trust region radius
+   * @param _endRadius final trust region radius
+   */
+  moTrustRegion(Neighborhood& _neighborhood,
+		eoEvalFunc<EOT>& _fullEval,
+		moEval<Neighbor>& _eval,
+		double _initRadius=0.1,
+		double _endRadius=1e-8)
+    : moLocalSearch<Neighbor>(explorer,trueCont,_fullEval),
+    explorer(_neighborhood,_eval,_fullEval,_initRadius,_endRadius)
+    {}
+
+  /**
+   * @return the trust region explorer for setting its parameters
+   */
+  moTrustRegionExplorer<Neighbor>& getExplorer() {
+    return explorer;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return std::string("moTrustRegion");
+  }
+
+ private:
+
+  /// default continuator
+  moTrueContinuator<Neighbor> trueCont;
+
+  /// the trust region explorer
+  moTrustRegionExplorer<Neighbor> explorer;
+};
+
+#endif
@@ -0,0 +1,78 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moArchiveStep_h
+#define _moArchiveStep_h
+
+#include "continuator/moContinuator.h"
+#include "../eval/eoArchiveEval.h"
+
+/**
+ * \file  moArchiveStep.h
+ * \class moArchiveStep
+ *
+ * Continuator passing the iteration counter of a local search to the
+ * evaluation archive, s.t. archived points are tagged by their iteration.
+ *
+ * @date: Oct. 2026
+ */
+template<class Neighbor>
+class moArchiveStep : public moContinuator<Neighbor> {
+
+public:
+
+  typedef typename Neighbor::EOT EOT;
+
+  /**
+   * Cor
+   *
+   * @param _archive archiving evaluation
+   */
+  moArchiveStep(eoArchiveEval<EOT>& _archive) : archive(_archive),iterations(0) { }
+
+  /// set the iteration counter (resume)
+  void setIterations(unsigned long _iterations) {
+    iterations = _iterations;
+    archive.setStep(iterations);
+  }
+
+  /**
+   * count the iteration
+   * @return true
+   */
+  virtual bool operator()(EOT& _solution) {
+    archive.setStep(++iterations);
+    return true;
+  }
+
+  /**
+   * Class name
+   */
+  virtual std::string className() const {
+    return "moArchiveStep";
+  }
+
+ protected:
+
+  eoArchiveEval<EOT>&  archive;     ///> archiving evaluation
+  unsigned long        iterations;  ///> iteration counter
+};
+
+#endif
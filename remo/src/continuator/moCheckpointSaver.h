@@ -0,0 +1,124 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moCheckpointSaver_h
+#define _moCheckpointSaver_h
+
+#include <string>
+#include <eo>
+#include "continuator/moContinuator.h"
+
+#include "util/Checkpoint.h"
+
+/**
+ * \file  moCheckpointSaver.h
+ * \class moCheckpointSaver
+ *
+ * Continuator writing a binary checkpoint (see util/Checkpoint.h) of the
+ * current solution, the evaluation counter, the iteration counter and the
+ * global random number generator each every-th iteration and at the end of
+ * the local search. The files are written in a background thread.
+ *
+ * After a resume the iterations are counted from the restored value
+ * (@see moTotalIterContinuator for the total number of iterations).
+ *
+ * @date: Oct. 2026
+ */
+template<class Neighbor>
+class moCheckpointSaver : public moContinuator<Neighbor> {
+
+public:
+
+  typedef typename Neighbor::EOT EOT;
+
+  /**
+   * Cor
+   *
+   * @param _counter  evaluation counter
+   * @param _file     checkpoint file
+   * @param _every    checkpoint each _every iterations
+   */
+  moCheckpointSaver(eoEvalFuncCounter<EOT>& _counter,const std::string& _file,unsigned int _every=100)
+    : counter(_counter),writer(_file),every(_every),iterations(0) { }
+
+  /**
+   * set the iteration counter (resume)
+   */
+  void setIterations(unsigned long _iterations) {
+    iterations = _iterations;
+  }
+
+  /**
+   * count the iteration and write a checkpoint each every-th iteration
+   *
+   * @param _solution current solution
+   * @return true
+   */
+  virtual bool operator()(EOT& _solution) {
+    iterations++;
+    if(every > 0 && iterations % every == 0)
+      save(_solution);
+    return true;
+  }
+
+  /**
+   * write the final checkpoint
+   */
+  virtual void lastCall(EOT& _solution) {
+    save(_solution);
+    writer.flush();
+  }
+
+  /**
+   * snapshot the state and hand it to the background writer
+   */
+  void save(const EOT& _solution) {
+    Checkpoint cp;
+    cp.kind = Checkpoint::LOCALSEARCH;
+    cp.evaluations = counter.value();
+    cp.steps = iterations;
+    cp.setRng(rng);
+    cp.addSolution(_solution);
+    cp.serialize(buffer);
+    writer.write(buffer);
+  }
+
+  /// @return number of iterations
+  unsigned long getIterations() const {
+    return iterations;
+  }
+
+  /**
+   * Class name
+   */
+  virtual std::string className() const {
+    return "moCheckpointSaver";
+  }
+
+ protected:
+
+  eoEvalFuncCounter<EOT>&  counter;        ///> evaluation counter
+  CheckpointWriter         writer;         ///> background writer
+  std::vector<char>        buffer;         ///> serialized snapshot
+  unsigned int             every;          ///> checkpoint frequency
+  unsigned long            iterations;     ///> iteration counter
+};
+
+#endif
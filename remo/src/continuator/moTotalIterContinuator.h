@@ -0,0 +1,94 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moTotalIterContinuator_h
+#define _moTotalIterContinuator_h
+
+#include "continuator/moContinuator.h"
+
+/**
+ * \file  moTotalIterContinuator.h
+ * \class moTotalIterContinuator
+ *
+ * Maximum number of iterations (as moIterContinuator) counted in total 
+ * over a resumed run: the iterations before the resume are set by 
+ * setIterations(). 
+ *
+ * @date: Oct. 2026
+ */
+template<class Neighbor>
+class moTotalIterContinuator : public moContinuator<Neighbor> {
+
+public:
+
+  typedef typename Neighbor::EOT EOT;
+
+  /**
+   * Cor
+   *
+   * @param _maxIter  total number of iterations
+   */
+  moTotalIterContinuator(unsigned long _maxIter) : maxIter(_maxIter),previous(0),iterations(0) { }
+
+  /**
+   * @param _previous  number of iterations before the resume
+   */
+  void setIterations(unsigned long _previous) {
+    previous = _previous;
+  }
+
+  /**
+   * @param _solution  initial solution 
+   */
+  virtual void init(EOT& _solution) {
+    iterations = previous;
+  }
+
+  /**
+   * count the iteration 
+   *
+   * @param _solution current solution
+   * @return false if the total number of iterations is reached
+   */
+  virtual bool operator()(EOT& _solution) {
+    iterations++;
+    return iterations < maxIter;
+  }
+
+  /// @return number of iterations in total
+  unsigned long value() const {
+    return iterations;
+  }
+
+  /**
+   * Class name
+   */
+  virtual std::string className() const {
+    return "moTotalIterContinuator";
+  }
+
+ protected:
+
+  unsigned long  maxIter;     ///> total number of iterations
+  unsigned long  previous;    ///> iterations before the resume
+  unsigned long  iterations;  ///> iteration counter
+};
+
+#endif
@@ -0,0 +1,107 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _eoArchiveEval_h
+#define _eoArchiveEval_h
+
+#include <string>
+#include <iostream>
+#include <eo>
+
+#include "util/EvalArchive.h"
+#include "util/ParallelEval.h"
+
+/**
+ * \file  eoArchiveEval.h
+ * \class eoArchiveEval
+ *
+ * Evaluation decorator appending each evaluated point to an EvalArchive
+ * together with its fitness, the wall clock time, the worker thread and the
+ * current algorithm step. Without an archive it only forwards to the wrapped
+ * evaluation. It can be called concurrently from the worker threads.
+ *
+ * @date: Oct. 2026
+ */
+template<class EOT>
+class eoArchiveEval : public eoEvalFunc<EOT> {
+
+public:
+
+  /**
+   * Cor
+   *
+   * @param _eval wrapped evaluation
+   */
+  eoArchiveEval(eoEvalFunc<EOT>& _eval) : eval(_eval),archive(0),step(0) { }
+
+  /// Destructor
+  virtual ~eoArchiveEval() {
+    delete archive;
+  }
+
+  /**
+   * open (or create) the archive file
+   *
+   * @param _file       archive file
+   * @param _dimension  dimension of the solutions
+   * @return false on failure
+   */
+  bool open(const std::string& _file,unsigned int _dimension) {
+    delete archive;
+    archive = new EvalArchive();
+    if(!archive->create(_file,_dimension)) {
+      std::cerr << "eoArchiveEval: cannot open archive " << _file << " of dimension " << _dimension << std::endl;
+      delete archive;
+      archive = 0;
+      return false;
+    }
+    return true;
+  }
+
+  /// set the current algorithm step (iteration / generation)
+  void setStep(unsigned long _step) {
+    step = _step;
+  }
+
+  /// @return the archive (0: none)
+  EvalArchive* getArchive() {
+    return archive;
+  }
+
+  /**
+   * evaluate an invalid solution and archive it
+   *
+   * @param _eo solution
+   */
+  virtual void operator()(EOT& _eo) {
+    if(!_eo.invalid()) return;
+    eval(_eo);
+    if(archive != 0 && _eo.size() == archive->getDimension())
+      archive->append(&_eo[0],(double) _eo.fitness(),ParallelEval::threadId(),step);
+  }
+
+ protected:
+
+  eoEvalFunc<EOT>&  eval;     ///> wrapped evaluation
+  EvalArchive*      archive;  ///> archive (0: none)
+  unsigned long     step;     ///> current algorithm step
+};
+
+#endif
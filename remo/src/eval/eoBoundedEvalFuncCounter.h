@@ -0,0 +1,90 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015 
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/ 
+
+#ifndef _eoBoundedEvalFuncCounter_h
+#define _eoBoundedEvalFuncCounter_h
+
+#include <cmath>
+#include "eoParallelEvalFuncCounter.h"
+
+/**
+ * \file  eoBoundedEvalFuncCounter.h
+ * \class eoBoundedEvalFuncCounter 
+ * 
+ * Thread-safe counter of objective function evaluations with a budget 
+ * checked per evaluation: once maxEval evaluations are counted, further 
+ * solutions are not evaluated but get the worst fitness, s.t. a search 
+ * rejects them and its evaluation continuator stops at the next check. 
+ * The budget is never exceeded, also not by the concurrent evaluations 
+ * of a neighborhood (@see ParallelEval). 
+ * 
+ * @date: Oct. 2026
+ */ 
+template<class EOT>
+class eoBoundedEvalFuncCounter : public eoParallelEvalFuncCounter<EOT> {
+
+public:
+
+  typedef typename EOT::Fitness Fitness;
+
+  /**
+   * Cor
+   * 
+   * @param _func    objective function 
+   * @param _maxEval max. num. of function evaluations 
+   * @param _name    name of the counter 
+   */ 
+  eoBoundedEvalFuncCounter(eoEvalFunc<EOT>& _func,unsigned long _maxEval,std::string _name="Eval. ") 
+    : eoParallelEvalFuncCounter<EOT>(_func,_name),maxEval(_maxEval) { 
+    Fitness hi(HUGE_VAL),lo(-HUGE_VAL);
+    worst = hi < lo ? hi : lo;
+  }
+
+  /**
+   * evaluate an invalid solution and count, beyond the budget the 
+   * solution gets the worst fitness 
+   * 
+   * @param _eo solution 
+   */ 
+  virtual void operator()(EOT& _eo) {
+    if(!_eo.invalid()) return;
+    if(__sync_add_and_fetch(&(this->value()),1UL) <= maxEval) 
+      this->func(_eo);
+    else {
+      __sync_fetch_and_sub(&(this->value()),1UL);
+      _eo.fitness(worst);
+    }
+  }
+
+  /**
+   * @return whether the budget is exhausted 
+   */ 
+  bool exhausted() {
+    return this->value() >= maxEval;
+  }
+
+private:
+
+  unsigned long maxEval;  ///> max. num. of function evaluations 
+  Fitness       worst;    ///> fitness of the solutions beyond the budget 
+
+};
+
+#endif
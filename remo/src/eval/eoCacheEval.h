@@ -0,0 +1,124 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _eoCacheEval_h
+#define _eoCacheEval_h
+
+#include <string>
+#include <iostream>
+#include <eo>
+
+#include "util/EvalCache.h"
+
+/**
+ * \file  eoCacheEval.h
+ * \class eoCacheEval
+ *
+ * Evaluation decorator consulting a persistent EvalCache before calling the
+ * objective function, new objective values are inserted into the cache.
+ * Without a cache it only forwards to the wrapped evaluation. It can be
+ * called concurrently from the worker threads.
+ *
+ * @date: Oct. 2026
+ */
+template<class EOT>
+class eoCacheEval : public eoEvalFunc<EOT> {
+
+public:
+
+  /**
+   * Cor
+   *
+   * @param _eval wrapped evaluation
+   */
+  eoCacheEval(eoEvalFunc<EOT>& _eval) : eval(_eval),cache(0),hits(0),misses(0) { }
+
+  /// Destructor
+  virtual ~eoCacheEval() {
+    delete cache;
+  }
+
+  /**
+   * open (or create) the cache file
+   *
+   * @param _file       cache file
+   * @param _dimension  dimension of the solutions
+   * @param _capacity   max. number of cached points of a new cache
+   * @param _identity   identity of the objective function
+   * @return false on failure
+   */
+  bool open(const std::string& _file,unsigned int _dimension,unsigned long long _capacity,const std::string& _identity) {
+    delete cache;
+    cache = new EvalCache();
+    if(!cache->open(_file,_dimension,_capacity,_identity)) {
+      std::cerr << "eoCacheEval: cannot open cache " << _file << " of dimension " << _dimension << std::endl;
+      delete cache;
+      cache = 0;
+      return false;
+    }
+    return true;
+  }
+
+  /// @return the cache (0: none)
+  EvalCache* getCache() {
+    return cache;
+  }
+
+  /// @return number of objective values taken from the cache
+  unsigned long getNumHits() const {
+    return hits;
+  }
+
+  /// @return number of calls of the objective function
+  unsigned long getNumMisses() const {
+    return misses;
+  }
+
+  /**
+   * evaluate an invalid solution, from the cache if possible
+   *
+   * @param _eo solution
+   */
+  virtual void operator()(EOT& _eo) {
+    if(!_eo.invalid()) return;
+    if(cache == 0 || _eo.size() != cache->getDimension()) {
+      eval(_eo);
+      return;
+    }
+    double f;
+    if(cache->lookup(&_eo[0],f)) {
+      _eo.fitness(f);
+      __sync_fetch_and_add(&hits,1UL);
+      return;
+    }
+    eval(_eo);
+    __sync_fetch_and_add(&misses,1UL);
+    cache->insert(&_eo[0],(double) _eo.fitness());
+  }
+
+ protected:
+
+  eoEvalFunc<EOT>&  eval;     ///> wrapped evaluation
+  EvalCache*        cache;    ///> cache (0: none)
+  unsigned long     hits;     ///> number of cache hits
+  unsigned long     misses;   ///> number of cache misses
+};
+
+#endif
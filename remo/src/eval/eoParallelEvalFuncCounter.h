@@ -0,0 +1,71 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015 
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/ 
+
+#ifndef _eoParallelEvalFuncCounter_h
+#define _eoParallelEvalFuncCounter_h
+
+#include <eo>
+
+/**
+ * \file  eoParallelEvalFuncCounter.h
+ * \class eoParallelEvalFuncCounter 
+ * 
+ * Counter of objective function evaluations which can be called 
+ * concurrently from the worker threads of ParallelEval. 
+ * The counter is incremented atomically. 
+ * 
+ * @date: Oct. 2026
+ */ 
+template<class EOT>
+class eoParallelEvalFuncCounter : public eoEvalFuncCounter<EOT> {
+
+public:
+
+  /**
+   * Cor
+   * 
+   * @param _func objective function 
+   * @param _name name of the counter 
+   */ 
+  eoParallelEvalFuncCounter(eoEvalFunc<EOT>& _func,std::string _name="Eval. ") 
+    : eoEvalFuncCounter<EOT>(_func,_name) { }
+
+  /**
+   * evaluate an invalid solution and count 
+   * 
+   * @param _eo solution 
+   */ 
+  virtual void operator()(EOT& _eo) {
+    if(_eo.invalid()) {
+      __sync_fetch_and_add(&(this->value()),1UL);
+      this->func(_eo);
+    }
+  }
+
+  /**
+   * @return the counted objective function 
+   */ 
+  eoEvalFunc<EOT>& getFunc() {
+    return this->func;
+  }
+
+};
+
+#endif
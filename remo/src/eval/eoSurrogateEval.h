@@ -0,0 +1,78 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _eoSurrogateEval_h
+#define _eoSurrogateEval_h
+
+#include <eo>
+#include "moSurrogate.h"
+
+/**
+ * \file  eoSurrogateEval.h
+ * \class eoSurrogateEval
+ *
+ * Evaluation decorator feeding each true evaluation into a surrogate model.
+ * Without a model it only forwards to the wrapped evaluation.
+ * It can be called concurrently, the model updates are serialized.
+ *
+ * @date: Oct. 2026
+ */
+template<class EOT>
+class eoSurrogateEval : public eoEvalFunc<EOT> {
+
+public:
+
+  /**
+   * Cor
+   *
+   * @param _eval wrapped (counted) evaluation
+   */
+  eoSurrogateEval(eoEvalFunc<EOT>& _eval) : eval(_eval),model(0) { }
+
+  /**
+   * set the trained model (0: none)
+   */
+  void setModel(moSurrogate* _model) {
+    model = _model;
+  }
+
+  /**
+   * evaluate an invalid solution and train the model
+   *
+   * @param _eo solution
+   */
+  virtual void operator()(EOT& _eo) {
+    if(!_eo.invalid()) return;
+    eval(_eo);
+    if(model != 0) {
+#ifdef _OPENMP
+#pragma omp critical(eoSurrogateEval)
+#endif
+      model->add(_eo,(double) _eo.fitness());
+    }
+  }
+
+ protected:
+
+  eoEvalFunc<EOT>& eval;   ///> wrapped evaluation
+  moSurrogate*     model;  ///> trained model
+};
+
+#endif
@@ -0,0 +1,119 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moBoundedEvalByModif_h
+#define _moBoundedEvalByModif_h
+
+#include <vector>
+#include <algorithm>
+#include <eo>
+#include "eval/moEval.h"
+
+/**
+ * \file  moBoundedEvalByModif.h
+ * \class moBoundedEvalByModif
+ *
+ * Full evaluation of a backable neighbor (as moFullEvalByModif) which, once
+ * enabled, passes a cutoff to the bounded evaluation of the objective
+ * function (@see RSRRMVOF::operator()(EORVT&,double)). The cutoff is the
+ * best of the current solution and the neighbors evaluated since the
+ * solution changed: a hill climber (best or first improvement, minimizing)
+ * never selects a neighbor above it. Stopped evaluations yield a lower
+ * bound above the cutoff as fitness and are counted as evaluations.
+ *
+ * Do not enable it for algorithms accepting worse neighbors (SA, TS).
+ *
+ * @date: Oct. 2026
+ */
+template<class Neighbor,class ObjFunc>
+class moBoundedEvalByModif : public moEval<Neighbor> {
+
+public:
+
+  typedef typename moEval<Neighbor>::EOT EOT;
+  typedef typename moEval<Neighbor>::Fitness Fitness;
+
+  /**
+   * Cor
+   *
+   * @param _eval       full evaluation (used when disabled)
+   * @param _objective  objective function with bounded evaluation
+   * @param _counter    counter of the bounded evaluations
+   */
+  moBoundedEvalByModif(eoEvalFunc<EOT>& _eval,ObjFunc& _objective,eoEvalFuncCounter<EOT>& _counter)
+    : eval(_eval),objective(_objective),counter(_counter),bounded(false),best(0.0),numAborted(0) { }
+
+  /// enable / disable the bounded evaluation
+  void setBounded(bool _bounded) {
+    bounded = _bounded;
+    center.clear();
+  }
+
+  /// @return whether the bounded evaluation is enabled
+  bool isBounded() const {
+    return bounded;
+  }
+
+  /// @return number of evaluations stopped early
+  unsigned long getNumAborted() const {
+    return numAborted;
+  }
+
+  /**
+   * evaluate a neighbor
+   *
+   * @param _solution  current solution
+   * @param _neighbor  neighbor to evaluate
+   */
+  virtual void operator()(EOT& _solution,Neighbor& _neighbor) {
+    Fitness tmpFit = _solution.fitness();
+    if(!bounded) {
+      _neighbor.move(_solution);
+      eval(_solution);
+    } else {
+      // a new sweep starts when the solution has moved
+      if(center.size() != _solution.size() || !std::equal(center.begin(),center.end(),_solution.begin())) {
+	center.assign(_solution.begin(),_solution.end());
+	best = tmpFit;
+      }
+      _neighbor.move(_solution);
+      __sync_fetch_and_add(&(counter.value()),1UL);
+      if(!objective(_solution,best))
+	numAborted++;
+      else if((double) _solution.fitness() < best)
+	best = _solution.fitness();
+    }
+    _neighbor.fitness(_solution.fitness());
+    _neighbor.moveBack(_solution);
+    _solution.fitness(tmpFit);
+  }
+
+ protected:
+
+  eoEvalFunc<EOT>&          eval;        ///> full evaluation
+  ObjFunc&                  objective;   ///> objective function
+  eoEvalFuncCounter<EOT>&   counter;     ///> counter of evaluations
+  bool                      bounded;     ///> whether the cutoff is used
+  std::vector<double>       center;      ///> solution of the current sweep
+  double                    best;        ///> cutoff of the current sweep
+  unsigned long             numAborted;  ///> number of stopped evaluations
+};
+
+#endif
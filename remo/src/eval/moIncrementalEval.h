@@ -0,0 +1,94 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moIncrementalEval_h
+#define _moIncrementalEval_h
+
+#include <eo>
+#include "eval/moEval.h"
+
+/**
+ * \file  moIncrementalEval.h
+ * \class moIncrementalEval
+ *
+ * Evaluation of a subspace neighbor (@see moRealSubspaceNeighbor) by the
+ * incremental evaluation of the objective function if it provides one
+ * (@see RSRRMVOF::evalIncremental()): the value of the neighbor follows
+ * from the value of the solution and the changed coordinates in O(d).
+ * Otherwise the neighbor is moved, fully evaluated and moved back.
+ *
+ * Incremental evaluations are counted as evaluations but neither cached
+ * nor archived, rounding errors accumulate over many moves.
+ *
+ * @date: Oct. 2026
+ */
+template<class Neighbor,class ObjFunc>
+class moIncrementalEval : public moEval<Neighbor> {
+
+public:
+
+  typedef typename moEval<Neighbor>::EOT EOT;
+  typedef typename moEval<Neighbor>::Fitness Fitness;
+
+  /**
+   * Cor
+   *
+   * @param _objective  objective function
+   * @param _counter    counted full evaluation, also counts the incremental ones
+   */
+  moIncrementalEval(ObjFunc& _objective,eoEvalFuncCounter<EOT>& _counter)
+    : objective(_objective),counter(_counter),numIncremental(0) { }
+
+  /// @return number of incremental evaluations
+  unsigned long getNumIncremental() const {
+    return numIncremental;
+  }
+
+  /**
+   * evaluate a neighbor
+   *
+   * @param _solution  current solution
+   * @param _neighbor  neighbor to evaluate
+   */
+  virtual void operator()(EOT& _solution,Neighbor& _neighbor) {
+    double value;
+    if(!_solution.invalid() &&
+       objective.evalIncremental(_solution,_solution.fitness(),_neighbor.size(),_neighbor.getIndex(),&_neighbor[0],value)) {
+      __sync_fetch_and_add(&(counter.value()),1UL);
+      numIncremental++;
+      _neighbor.fitness(value);
+      return;
+    }
+    Fitness tmpFit = _solution.fitness();
+    _neighbor.move(_solution);
+    counter(_solution);
+    _neighbor.fitness(_solution.fitness());
+    _neighbor.moveBack(_solution);
+    _solution.fitness(tmpFit);
+  }
+
+ protected:
+
+  ObjFunc&                  objective;       ///> objective function
+  eoEvalFuncCounter<EOT>&   counter;         ///> counted full evaluation
+  unsigned long             numIncremental;  ///> number of incremental evaluations
+};
+
+#endif
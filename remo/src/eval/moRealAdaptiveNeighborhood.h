@@ -0,0 +1,150 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moRealAdaptiveNeighborhood_h
+#define _moRealAdaptiveNeighborhood_h
+
+#include <algorithm>
+#include "moRealBoundaryNeighborhood.h"
+
+/**
+ * \file  moRealAdaptiveNeighborhood.h
+ * \class moRealAdaptiveNeighborhood
+ *
+ * Boundary neighborhood whose radius is adapted by a success rule. The 
+ * outcome of each evaluated neighbor is reported explicitly by the neighbor 
+ * evaluation of the local search (@see moSuccessRateEval). 
+ *
+ * @date: Oct. 2026
+ */
+template <class Fitness>
+class moRealAdaptiveNeighborhood : public moRealBoundaryNeighborhood<Fitness>
+{
+public:
+
+  /**
+   * Constructor @see moRealBoundaryNeighborhood
+   */
+ moRealAdaptiveNeighborhood(unsigned _maxNumNeighbors,double _eps,eoRng& _rng=rng)
+   : moRealBoundaryNeighborhood<Fitness>(_maxNumNeighbors,_eps,_rng),
+    adaptive(false),target(0.2),factor(0.85),window(0),minRadius(1e-12),
+    numObserved(0),numImproving(0),windowObserved(0),windowImproving(0) {
+  }
+
+  /**
+   * adapt the radius by a success rule: after each _window evaluated neighbors 
+   * the radius is divided by _factor if more than a fraction _target of them 
+   * improved their solution and multiplied by _factor if less 
+   * (1/5th rule for _target = 0.2)
+   * 
+   * @param _target     target success rate ]0,1[
+   * @param _factor     shrinking factor ]0,1[
+   * @param _window     num. of evaluated neighbors between adaptations (0: neighborhood size)
+   * @param _minRadius  min. radius 
+   */
+  void setAdaptive(double _target=0.2,double _factor=0.85,unsigned _window=0,double _minRadius=1e-12) {
+    adaptive = true;
+    target = _target;
+    factor = _factor;
+    window = _window > 0 ? _window : this->maxNumNeighbors + 1;
+    minRadius = _minRadius;
+  }
+
+  /// @return whether the radius is adapted
+  bool isAdaptive() const {
+    return adaptive;
+  }
+
+  /**
+   * success rule: count whether an evaluated neighbor improved its solution 
+   * and adapt the radius at the end of a window 
+   * 
+   * @param _parent    fitness of the explored solution
+   * @param _neighbor  fitness of the evaluated neighbor
+   */
+  void observe(const Fitness& _parent,const Fitness& _neighbor) {
+    if(!adaptive) return;
+    numObserved++;
+    windowObserved++;
+    if(_neighbor > _parent) {
+      numImproving++;
+      windowImproving++;
+    }
+    if(windowObserved >= window) {
+      double rate = (double) windowImproving / windowObserved;
+      if(rate > target) this->eps /= factor;
+      else if(rate < target) this->eps = std::max(this->eps * factor,minRadius);
+      windowObserved = windowImproving = 0;
+    }
+  }
+
+  /**
+   * @return number of evaluated neighbors improving their solution
+   */ 
+  unsigned long getNumImproving() const {
+    return numImproving;
+  }
+
+  /**
+   * @return number of evaluated neighbors observed by the success rule 
+   */ 
+  unsigned long getNumObserved() const {
+    return numObserved;
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return "moRealAdaptiveNeighborhood";
+  }
+
+protected:
+
+    /// whether the radius is adapted by the success rule
+    bool adaptive; 
+
+    /// target success rate
+    double target; 
+
+    /// shrinking factor of the radius
+    double factor; 
+
+    /// num. of evaluated neighbors between adaptations
+    unsigned window; 
+
+    /// min. radius
+    double minRadius; 
+
+    /// number of observed neighbors
+    unsigned long numObserved; 
+
+    /// number of observed neighbors improving their solution
+    unsigned long numImproving; 
+
+    /// number of observed neighbors in the current window
+    unsigned long windowObserved; 
+
+    /// number of improving neighbors in the current window
+    unsigned long windowImproving; 
+};
+
+#endif
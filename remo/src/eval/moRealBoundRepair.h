@@ -0,0 +1,122 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moRealBoundRepair_h
+#define _moRealBoundRepair_h
+
+#include <vector>
+#include <algorithm>
+
+/**
+ * \file  moRealBoundRepair.h
+ * \class moRealBoundRepair
+ *
+ * Repair of the neighbors leaving the bounds before they are handed out 
+ * by a neighborhood, i.e. before any evaluation: a coordinate leaving 
+ * the box is clipped to the bound, reflected at the bound or redrawn 
+ * (@see moRealBoundaryNeighborhood::setRepair). 
+ *
+ * @date: Oct. 2026
+ */
+class moRealBoundRepair {
+
+public:
+
+  /// repair of neighbors leaving the bounds 
+  enum Repair { NONE, CLIP, REFLECT, RESAMPLE };
+
+  /**
+   * Cor.
+   *
+   * @param _mode  repair of infeasible coordinates (NONE: bounds are ignored)
+   */
+  moRealBoundRepair(Repair _mode=NONE) : mode(_mode),numRepaired(0) { }
+
+  /**
+   * @param _lowerBound  lower bounds
+   * @param _upperBound  upper bounds
+   */
+  void setBounds(const std::vector<double>& _lowerBound,const std::vector<double>& _upperBound) {
+    lowerBound = _lowerBound;
+    upperBound = _upperBound;
+  }
+
+  /**
+   * @param _mode repair of infeasible coordinates (NONE: bounds are ignored)
+   */
+  void setMode(Repair _mode) {
+    mode = _mode;
+  }
+
+  /// @return repair of infeasible coordinates
+  Repair getMode() const {
+    return mode;
+  }
+
+  /// @return whether neighbors are repaired
+  bool active() const {
+    return mode != NONE && !lowerBound.empty();
+  }
+
+  /**
+   * @return number of infeasible neighbors which were repaired 
+   */ 
+  unsigned long getNumRepaired() const {
+    return numRepaired;
+  }
+
+  /**
+   * repair an offset s.t. the neighbor _solution + _v is within the bounds 
+   *
+   * @param _solution      solution to explore
+   * @param _v             offsets of the neighbor
+   * @param _neighborhood  redraws an offset (RESAMPLE), @see moRealBoundaryNeighborhood::drawOffset
+   */
+  template<class EOT,class Neighborhood>
+  void operator()(const EOT& _solution,double* _v,Neighborhood& _neighborhood) {
+    int n = _solution.size();
+    if(lowerBound.size() != n || upperBound.size() != n) return;
+    bool infeasible = false;
+    for(int i=0;i<n;i++) {
+      double lo = lowerBound[i], hi = upperBound[i];
+      double y = _solution[i] + _v[i];
+      if(y >= lo && y <= hi) continue;
+      infeasible = true;
+      if(mode == REFLECT) 
+	y = y < lo ? 2 * lo - y : 2 * hi - y;
+      else if(mode == RESAMPLE) 
+	for(int k=0;k<10 && (y < lo || y > hi);k++) 
+	  y = _solution[i] + _neighborhood.drawOffset(i);
+      // clip, also if the radius exceeds the box 
+      y = std::min(std::max(y,lo),hi);
+      _v[i] = y - _solution[i];
+    }
+    if(infeasible) numRepaired++;
+  }
+
+ protected:
+
+  Repair               mode;         ///> repair of infeasible neighbors
+  std::vector<double>  lowerBound;   ///> lower bounds of the neighbors
+  std::vector<double>  upperBound;   ///> upper bounds of the neighbors
+  unsigned long        numRepaired;  ///> number of repaired neighbors
+};
+
+#endif
@@ -25,6 +25,9 @@
 #include <vector>
 #include "neighborhood/moNeighborhood.h"
 #include "utils/eoRndGenerators.h"
+#include "moRealSampler.h"
+#include "moRealBoundRepair.h"
+#include "moRealScreening.h"
 
 /**
  * \file moRealBoundaryNeighborhood.h
@@ -34,6 +37,12 @@
  * where g \in N_eps(s), N_eps(s) is specified via a random generator   
  * It works with classes of types moBackableNeighbor, e.g. moRealNeighbor
  * 
+ * The radius can be scaled per coordinate. The generation of the offsets 
+ * is customized by policies which are not owned by the neighborhood: 
+ * a sampler of the unit cube (@see moRealSobolSampler), a repair of 
+ * neighbors leaving the bounds (@see moRealBoundRepair) and a screening 
+ * of the candidates by a surrogate model (@see moRealScreening). 
+ * 
  * \todo a template for a generator 
  * 
  * @author: Atiyah Elsheikh
@@ -55,9 +64,49 @@ public:
   /**
    * Constructor
    * @param _maxNumNeighbors
+   * @param _eps radius of the neighborhood
+   * @param _rng random number generator (a private one for concurrent local searches)
+   */
+ moRealBoundaryNeighborhood(unsigned _maxNumNeighbors,double _eps,eoRng& _rng=rng)
+   : moNeighborhood<Neighbor>(),maxNumNeighbors(_maxNumNeighbors),eps(_eps),numGenNeighbors(0),generator(0.0,1.0,_rng),
+    sampler(0),repair(0),screening(0),numScreened(0) {
+  }
+
+  /**
+   * scale the radius per coordinate, e.g. by the ranges of the variables 
+   * 
+   * @param _scale  scaling factors (empty: none)
+   */
+  void setScale(const std::vector<double>& _scale) {
+    scale = _scale;
+  }
+
+  /**
+   * @return the current radius 
+   */ 
+  double getRadius() const {
+    return eps;
+  }
+
+  /**
+   * @param _sampler  sampler of the offsets (0: pseudo random)
    */
- moRealBoundaryNeighborhood(unsigned _maxNumNeighbors,double _eps)
-   : moNeighborhood<Neighbor>(),maxNumNeighbors(_maxNumNeighbors),eps(_eps),numGenNeighbors(0) {
+  void setSampler(moRealSampler* _sampler) {
+    sampler = _sampler;
+  }
+
+  /**
+   * @param _repair  repair of the neighbors leaving the bounds (0: none)
+   */
+  void setRepair(moRealBoundRepair* _repair) {
+    repair = _repair;
+  }
+
+  /**
+   * @param _screening  pre-screening of the neighbors by a surrogate model (0: none)
+   */
+  void setScreening(moRealScreening* _screening) {
+    screening = _screening;
   }
 
   /**
@@ -66,7 +115,7 @@ public:
    * @return true if the neighborhood was not empty (bit string larger than 0)
    */
   virtual bool hasNeighbor(EOT& _solution) {
-    if(numGenNeighbors > maxNumNeighbors) {
+    if(numGenNeighbors > (numScreened > 0 ? numScreened - 1 : maxNumNeighbors)) {
       numGenNeighbors = 0; 
       return false;
     }
@@ -81,6 +130,11 @@ public:
    */
   virtual void init(EOT& _solution, Neighbor& _current) {
     numGenNeighbors = 0; 
+    numScreened = 0; 
+    if(sampler != 0) 
+      sampler->restart(_solution.size(),generator);
+    if(screening != 0 && screening->active()) 
+      numScreened = screening->screen(_solution,*this,maxNumNeighbors + 1);
     next(_solution,_current);
   }
 
@@ -93,10 +147,13 @@ public:
     if(_current.size() != _solution.size()) {
       _current.resize(_solution.size()); 
     }
-    for(int i=0;i<_solution.size();i++) {
-      double v = (generator()- 0.5) * eps * 2;
-      _current[i] = v; //_solution[i] + v;
+    if(numScreened > 0) {
+      const double* v = screening->getOffsets(numGenNeighbors);
+      for(int i=0;i<_solution.size();i++) 
+	_current[i] = v[i];
     }
+    else 
+      drawOffsets(_solution,&_current[0]); //_solution[i] + v;
     numGenNeighbors++;  
   }
 
@@ -117,7 +174,39 @@ public:
     return "moRealBoundaryNeighborhood";
   }
 
+  /**
+   * draw the offsets of a neighbor, repaired if a repair is set 
+   * 
+   * @param _solution  the solution to explore
+   * @param _v         offsets of the _solution.size() coordinates 
+   */
+  void drawOffsets(const EOT& _solution,double* _v) {
+    int n = _solution.size();
+    if(sampler != 0) {
+      sampler->next(n,_v,generator);
+      for(int i=0;i<n;i++) 
+	_v[i] = offset(i,_v[i]);
+    }
+    else 
+      for(int i=0;i<n;i++) 
+	_v[i] = offset(i,generator());
+    if(repair != 0 && repair->active()) 
+      (*repair)(_solution,_v,*this);
+  }
+
+  /// @return a pseudo random offset of coordinate _i
+  double drawOffset(int _i) {
+    return offset(_i,generator());
+  }
+
 protected:
+
+    /// offset of coordinate _i for a uniform number _u in [0,1) 
+    double offset(int _i,double _u) const {
+      double v = (_u - 0.5) * eps * 2;
+      return _i < scale.size() ? v * scale[_i] : v;
+    }
+
     /// the radius of the boundary around a solution to be explored
     double eps; 
 
@@ -129,6 +218,21 @@ protected:
 
     /// uniform generator
     eoUniformGenerator<double> generator;
+
+    /// scaling of the radius per coordinate (empty: none)
+    std::vector<double> scale; 
+
+    /// sampler of the offsets (0: pseudo random)
+    moRealSampler* sampler; 
+
+    /// repair of infeasible neighbors (0: none)
+    moRealBoundRepair* repair; 
+
+    /// pre-screening by a surrogate model (0: none)
+    moRealScreening* screening; 
+
+    /// number of enumerated candidates after screening (0: no screening)
+    int numScreened; 
 };
 
 #endif
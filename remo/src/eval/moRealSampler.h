@@ -0,0 +1,112 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moRealSampler_h
+#define _moRealSampler_h
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "utils/eoRndGenerators.h"
+#include "util/Sobol.h"
+
+/**
+ * \file  moRealSampler.h
+ * \class moRealSampler
+ *
+ * Sampler of the unit cube for the offsets of a neighborhood 
+ * (@see moRealBoundaryNeighborhood). The sequence is restarted 
+ * each time the neighborhood of a solution is explored. 
+ *
+ * @date: Oct. 2026
+ */
+class moRealSampler {
+
+public:
+
+  /// Destructor
+  virtual ~moRealSampler() { }
+
+  /**
+   * restart the sequence 
+   *
+   * @param _n    dimension
+   * @param _gen  uniform generator of the neighborhood
+   */
+  virtual void restart(unsigned _n,eoUniformGenerator<double>& _gen)=0;
+
+  /**
+   * next point of the sequence 
+   *
+   * @param _n    dimension
+   * @param _u    point in [0,1)^_n
+   * @param _gen  uniform generator of the neighborhood
+   */
+  virtual void next(unsigned _n,double* _u,eoUniformGenerator<double>& _gen)=0;
+
+  /// @return the class name
+  virtual std::string className() const {
+    return "moRealSampler";
+  }
+};
+
+
+/**
+ * \class moRealSobolSampler
+ *
+ * Sobol sequence with a fresh random digital shift per restart 
+ * (@see Sobol), s.t. a few neighbors cover the box evenly instead 
+ * of clustering. Coordinates beyond Sobol::MAXDIM are pseudo random. 
+ */
+class moRealSobolSampler : public moRealSampler {
+
+public:
+
+  virtual void restart(unsigned _n,eoUniformGenerator<double>& _gen) {
+    if(sobol.size() != std::min<unsigned>(_n,Sobol::MAXDIM)) 
+      sobol.resize(_n);
+    point.resize(sobol.size());
+    shift.resize(sobol.size());
+    for(unsigned i=0;i<shift.size();i++) 
+      shift[i] = (uint32_t) (_gen() * 4294967296.0);
+    sobol.restart(shift);
+  }
+
+  virtual void next(unsigned _n,double* _u,eoUniformGenerator<double>& _gen) {
+    unsigned d = std::min<unsigned>(sobol.size(),_n);
+    sobol.next(&point[0]);
+    for(unsigned i=0;i<d;i++) 
+      _u[i] = point[i];
+    for(unsigned i=d;i<_n;i++) 
+      _u[i] = _gen();
+  }
+
+  virtual std::string className() const {
+    return "moRealSobolSampler";
+  }
+
+ protected:
+
+  Sobol                  sobol;  ///> low discrepancy sequence of the offsets
+  std::vector<double>    point;  ///> point of the Sobol sequence
+  std::vector<uint32_t>  shift;  ///> digital shift of the Sobol sequence
+};
+
+#endif
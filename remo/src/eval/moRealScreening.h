@@ -0,0 +1,124 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moRealScreening_h
+#define _moRealScreening_h
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include "moSurrogate.h"
+
+/**
+ * \file  moRealScreening.h
+ * \class moRealScreening
+ *
+ * Pre-screening of the neighbors by a surrogate model: all candidates 
+ * are generated, ranked by the model and only the most promising fraction 
+ * is enumerated (and hence truly evaluated by the local search) 
+ * (@see moRealBoundaryNeighborhood::setScreening). 
+ *
+ * @date: Oct. 2026
+ */
+class moRealScreening {
+
+public:
+
+  /// Cor.
+  moRealScreening() : surrogate(0),fraction(1.0),numRejected(0),n(0) { }
+
+  /**
+   * @param _surrogate  model of the objective function (0: no screening)
+   * @param _fraction   fraction of the candidates which is enumerated ]0,1]
+   */
+  void setSurrogate(const moSurrogate* _surrogate,double _fraction) {
+    surrogate = _surrogate;
+    fraction = _fraction > 0.0 && _fraction < 1.0 ? _fraction : 1.0;
+  }
+
+  /// @return whether the candidates are screened
+  bool active() const {
+    return surrogate != 0 && fraction < 1.0 && surrogate->ready();
+  }
+
+  /**
+   * @return number of candidates discarded by the surrogate model 
+   */ 
+  unsigned long getNumRejected() const {
+    return numRejected;
+  }
+
+  /**
+   * generate all candidates and keep the most promising ones w.r.t. the model
+   *
+   * @param _solution       solution to explore
+   * @param _neighborhood   generates the offsets, @see moRealBoundaryNeighborhood::drawOffsets
+   * @param _numCandidates  number of candidates
+   * @return number of kept candidates 
+   */
+  template<class EOT,class Neighborhood>
+  int screen(const EOT& _solution,Neighborhood& _neighborhood,int _numCandidates) {
+    n = _solution.size();
+    offsets.resize(_numCandidates * n);
+    order.resize(_numCandidates);
+    predicted.resize(_numCandidates);
+    candidate.resize(n);
+    for(int c=0;c<_numCandidates;c++) {
+      double* v = &offsets[c * n];
+      _neighborhood.drawOffsets(_solution,v);
+      for(int i=0;i<n;i++) 
+	candidate[i] = _solution[i] + v[i];
+      predicted[c] = surrogate->predict(candidate);
+      order[c] = c;
+    }
+    int numScreened = std::max(1,(int) std::ceil(fraction * _numCandidates));
+    std::partial_sort(order.begin(),order.begin()+numScreened,order.end(),PredictionCompare(predicted));
+    numRejected += _numCandidates - numScreened;
+    return numScreened;
+  }
+
+  /**
+   * @param _k  rank of a kept candidate
+   * @return its offsets 
+   */
+  const double* getOffsets(int _k) const {
+    return &offsets[order[_k] * n];
+  }
+
+ protected:
+
+  /// ascending order of predicted objective values 
+  struct PredictionCompare {
+    PredictionCompare(const std::vector<double>& _f) : f(_f) { }
+    bool operator()(int _a,int _b) const { return f[_a] < f[_b]; }
+    const std::vector<double>& f;
+  };
+
+  const moSurrogate*   surrogate;    ///> surrogate model for pre-screening (0: none)
+  double               fraction;     ///> fraction of enumerated candidates
+  unsigned long        numRejected;  ///> number of discarded candidates
+  int                  n;            ///> dimension of the candidates
+  std::vector<double>  offsets;      ///> candidate offsets (numCandidates x n)
+  std::vector<int>     order;        ///> candidates sorted by predicted value
+  std::vector<double>  predicted;    ///> predicted values
+  std::vector<double>  candidate;    ///> candidate solution
+};
+
+#endif
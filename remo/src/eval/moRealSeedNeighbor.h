@@ -0,0 +1,217 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moRealSeedNeighbor_h
+#define _moRealSeedNeighbor_h
+
+#include <vector>
+#include <stdint.h>
+#include "EO.h"
+#include "es/eoReal.h"
+#include "neighborhood/moBackableNeighbor.h"
+
+/**
+ * \file  moRealSeedNeighbor.h
+ * \class moRealSeedContext
+ *
+ * Counter based generation of the offsets of seed neighbors: the offset of
+ * coordinate i of the neighbor (stream,counter) is a SplitMix64 hash of the
+ * stream, counter/2 and i mapped to [-eps,eps], i.e. any offset can be
+ * regenerated on demand without state. Odd counters negate the offsets of
+ * the preceding even counter, i.e. neighbors come in pairs of a move and
+ * its reverse.
+ *
+ * @date: Oct. 2026
+ */
+class moRealSeedContext {
+
+public:
+
+  /**
+   * Cor
+   *
+   * @param _eps radius of the neighborhood
+   */
+  moRealSeedContext(double _eps=0.1) : eps(_eps) { }
+
+  /// seed of the key (_stream,_counter)
+  static uint64_t seed(uint64_t _stream,uint64_t _counter) {
+    return mix(_stream ^ mix((_counter >> 1) + 0x9E3779B97F4A7C15ULL));
+  }
+
+  /// offset of coordinate _i for the seed of a key
+  double offset(uint64_t _seed,unsigned _i) const {
+    double u = (mix(_seed + (_i + 1) * 0x9E3779B97F4A7C15ULL) >> 11) * (1.0 / 9007199254740992.0);
+    double v = (u - 0.5) * eps * 2;
+    return _i < scale.size() ? v * scale[_i] : v;
+  }
+
+  /// @return -1 for the reverse of a move (odd counter), 1 otherwise
+  static double sign(uint64_t _counter) {
+    return _counter & 1 ? -1.0 : 1.0;
+  }
+
+  double              eps;    ///> radius of the neighborhood
+  std::vector<double> scale;  ///> scaling of the radius per coordinate (empty: none)
+
+ protected:
+
+  /// SplitMix64 finalizer
+  static uint64_t mix(uint64_t _z) {
+    _z = (_z ^ (_z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    _z = (_z ^ (_z >> 27)) * 0x94D049BB133111EBULL;
+    return _z ^ (_z >> 31);
+  }
+
+};
+
+/**
+ * \class moRealSeedNeighbor
+ *
+ * A neighbor s^new_i = s_i + eps_i whose offsets are not stored but
+ * regenerated from a key (stream id, counter) by move() and moveBack()
+ * (@see moRealSeedContext). Copies of a neighbor, e.g. the best neighbor
+ * of a best improvement explorer or the entries of a tabu list, cost a key
+ * instead of n doubles. A neighbor equals itself and its reverse, s.t. a
+ * tabu list of keys forbids repeating and undoing a recent move once the
+ * streams are drawn from a finite pool (@see moRealSeedNeighborhood::setNumStreams).
+ * Bounds are not repaired: a move cannot be undone once an offset is clipped.
+ *
+ * @date: Oct. 2026
+ */
+template<class Fitness>
+class moRealSeedNeighbor : public moBackableNeighbor<eoReal<Fitness>,Fitness> {
+public:
+
+  typedef eoReal<Fitness> EOT;
+
+  /**
+   * Basic constructor
+   */
+  moRealSeedNeighbor() : moBackableNeighbor<EOT,Fitness>(),context(0),stream(0),counter(0) { }
+
+  /**
+   * Copy Constructor
+   * @param _n the neighbor to copy
+   */
+  moRealSeedNeighbor(const moRealSeedNeighbor& _n)
+    : moBackableNeighbor<EOT,Fitness>(_n),context(_n.context),stream(_n.stream),counter(_n.counter) { }
+
+  /**
+   * Assignment operator
+   * @param _source the source neighbor
+   */
+  moRealSeedNeighbor<Fitness>& operator=(const moRealSeedNeighbor<Fitness>& _source) {
+    moBackableNeighbor<EOT,Fitness>::operator=(_source);
+    context = _source.context;
+    stream = _source.stream;
+    counter = _source.counter;
+    return *this;
+  }
+
+  /**
+   * set the key
+   * @param _context  generation of the offsets (owned by the neighborhood)
+   * @param _stream   stream id
+   * @param _counter  counter within the stream
+   */
+  void setKey(const moRealSeedContext* _context,uint64_t _stream,uint64_t _counter) {
+    context = _context;
+    stream = _stream;
+    counter = _counter;
+  }
+
+  /// @return stream id
+  uint64_t getStream() const {
+    return stream;
+  }
+
+  /// @return counter within the stream
+  uint64_t getCounter() const {
+    return counter;
+  }
+
+  /**
+   * regenerate the offsets
+   * @param _n  dimension
+   * @param _v  _n offsets
+   */
+  void offsets(unsigned _n,double* _v) const {
+    uint64_t s = moRealSeedContext::seed(stream,counter);
+    double d = moRealSeedContext::sign(counter);
+    for(unsigned i=0;i<_n;i++) _v[i] = d * context->offset(s,i);
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return "moRealSeedNeighbor";
+  }
+
+  /**
+   * @param _neighbor a neighbor
+   * @return if _neighbor and this one are equals or reverse moves
+   */
+  virtual bool equals(moRealSeedNeighbor<Fitness>& _neighbor) const {
+    return context == _neighbor.context && stream == _neighbor.stream && (counter >> 1) == (_neighbor.counter >> 1);
+  }
+
+  /**
+   * Write object with its key
+   * @param _os A std::ostream.
+   */
+  virtual void printOn(std::ostream& _os) const {
+    EO<Fitness>::printOn(_os);
+    _os << ' ' << stream << ' ' << counter << ' ';
+  }
+
+  /**
+   * move the solution
+   * @param _solution a solution
+   */
+  virtual void move(EOT& _solution) {
+    uint64_t s = moRealSeedContext::seed(stream,counter);
+    double d = moRealSeedContext::sign(counter);
+    for(unsigned i=0;i<_solution.size();i++) _solution[i] += d * context->offset(s,i);
+    _solution.invalidate();
+  }
+
+  /**
+   * move the solution back
+   * @param _solution a solution
+   */
+  virtual void moveBack(EOT& _solution) {
+    uint64_t s = moRealSeedContext::seed(stream,counter);
+    double d = moRealSeedContext::sign(counter);
+    for(unsigned i=0;i<_solution.size();i++) _solution[i] -= d * context->offset(s,i);
+    _solution.invalidate();
+  }
+
+ protected:
+
+  const moRealSeedContext* context;  ///> generation of the offsets
+  uint64_t                 stream;   ///> stream id
+  uint64_t                 counter;  ///> counter within the stream
+
+};
+
+#endif
@@ -0,0 +1,163 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moRealSeedNeighborhood_h
+#define _moRealSeedNeighborhood_h
+
+#include <vector>
+#include "neighborhood/moNeighborhood.h"
+#include "moRealSeedNeighbor.h"
+
+/**
+ * \file moRealSeedNeighborhood.h
+ * \class moRealSeedNeighborhood
+ *
+ * The neighborhood of moRealBoundaryNeighborhood with seed neighbors
+ * (@see moRealSeedNeighbor): next() only sets the key (stream, counter),
+ * each iteration (init()) draws a stream id. Generating a neighbor
+ * costs O(1), the offsets are generated when the neighbor is moved.
+ * Consecutive neighbors are a move and its reverse. The stream ids are
+ * fresh unless a finite pool is set, then the moves of an iteration recur
+ * in later ones and can be recognized by a tabu list.
+ *
+ * @date: Oct. 2026
+ */
+template <class Fitness>
+class moRealSeedNeighborhood : virtual public moNeighborhood<moRealSeedNeighbor<Fitness> >
+{
+public:
+
+  typedef moRealSeedNeighbor<Fitness> Neighbor;
+
+  /**
+   * Define type of a solution corresponding to Neighbor
+   */
+  typedef typename Neighbor::EOT EOT;
+
+  /**
+   * Constructor
+   * @param _maxNumNeighbors
+   * @param _eps radius of the neighborhood
+   * @param _rng random number generator (a private one for concurrent local searches)
+   */
+  moRealSeedNeighborhood(unsigned _maxNumNeighbors,double _eps,eoRng& _rng=rng)
+    : moNeighborhood<Neighbor>(),maxNumNeighbors(_maxNumNeighbors),numGenNeighbors(0),context(_eps),random(_rng),numStreams(0),stream(0) { }
+
+  /**
+   * scale the radius per coordinate
+   *
+   * @param _scale  scaling factors (empty: none)
+   */
+  void setScale(const std::vector<double>& _scale) {
+    context.scale = _scale;
+  }
+
+  /**
+   * draw the stream ids from a finite pool, e.g. for a tabu search 
+   *
+   * @param _numStreams  size of the pool (0: a fresh stream per iteration)
+   */
+  void setNumStreams(uint32_t _numStreams) {
+    numStreams = _numStreams;
+  }
+
+  /**
+   * @return generation of the offsets
+   */
+  const moRealSeedContext& getContext() const {
+    return context;
+  }
+
+  /**
+   * Test if it exist a neighbor
+   * @param _solution the solution to explore
+   * @return true if the neighborhood was not empty
+   */
+  virtual bool hasNeighbor(EOT& _solution) {
+    if(numGenNeighbors > maxNumNeighbors) {
+      numGenNeighbors = 0;
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Initialization of the neighborhood: a stream of the pool or a new one
+   * @param _solution the solution to explore
+   * @param _current the first neighbor
+   */
+  virtual void init(EOT& _solution, Neighbor& _current) {
+    numGenNeighbors = 0;
+    if(numStreams > 0)
+      stream = random.random(numStreams);
+    else
+      stream = ((uint64_t) random.rand() << 32) ^ random.rand();
+    next(_solution,_current);
+  }
+
+  /**
+   * Give the next neighbor
+   * @param _solution the solution to explore
+   * @param _current the next neighbor
+   */
+  virtual void next(EOT& _solution, Neighbor& _current) {
+    _current.setKey(&context,stream,numGenNeighbors);
+    numGenNeighbors++;
+  }
+
+  /**
+   * Test if there is again a neighbor
+   * @param _solution the solution to explore
+   * @return true if there is again a neighbor not explored
+   */
+  virtual bool cont(EOT& _solution) {
+    return hasNeighbor(_solution);
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return "moRealSeedNeighborhood";
+  }
+
+protected:
+
+  /// maximum number of neighbors
+  int maxNumNeighbors;
+
+  /// number of generated neighbors
+  int numGenNeighbors;
+
+  /// generation of the offsets
+  moRealSeedContext context;
+
+  /// random number generator of the stream ids
+  eoRng& random;
+
+  /// size of the pool of stream ids (0: fresh ids)
+  uint32_t numStreams;
+
+  /// stream id of the current iteration
+  uint64_t stream;
+};
+
+#endif
@@ -0,0 +1,144 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moRealSubspaceNeighbor_h
+#define _moRealSubspaceNeighbor_h
+
+#include <vector>
+#include "EO.h"
+#include "es/eoReal.h"
+#include "neighborhood/moBackableNeighbor.h"
+
+/**
+ * \file  moRealSubspaceNeighbor.h
+ * \class moRealSubspaceNeighbor
+ *
+ * A neighbor moving only the d coordinates of a subspace:
+ * s^new_index[k] = s_index[k] + eps_k, k = 0..d-1
+ * The coordinates are drawn by the neighborhood for each iteration (@see
+ * moRealSubspaceNeighborhood), a neighbor stores a copy of the d
+ * coordinates and the d offsets, s.t. copies (e.g. the best neighbor or
+ * tabu list entries) stay valid after the next iteration. move() and
+ * moveBack() cost O(d) for any dimension of the solution.
+ *
+ * @date: Oct. 2026
+ */
+template<class Fitness>
+class moRealSubspaceNeighbor : public moBackableNeighbor<eoReal<Fitness>,Fitness> , public std::vector<double> {
+public:
+
+  typedef eoReal<Fitness> EOT;
+  typedef std::vector<double> EOVT;
+  using EOVT::operator[];
+  using EOVT::size;
+
+  /**
+   * Basic constructor
+   * @param _size number of coordinates of the subspace
+   */
+  moRealSubspaceNeighbor(unsigned _size=0) : moBackableNeighbor<EOT,Fitness>(),EOVT(_size,0.0) { }
+
+  /**
+   * Copy Constructor
+   * @param _n the neighbor to copy
+   */
+  moRealSubspaceNeighbor(const moRealSubspaceNeighbor& _n) : moBackableNeighbor<EOT,Fitness>(_n),EOVT(_n),index(_n.index) { }
+
+  /**
+   * Assignment operator
+   * @param _source the source neighbor
+   */
+  moRealSubspaceNeighbor<Fitness>& operator=(const moRealSubspaceNeighbor<Fitness>& _source) {
+    moBackableNeighbor<EOT,Fitness>::operator=(_source);
+    EOVT::operator=(_source);
+    index = _source.index;
+    return *this;
+  }
+
+  /**
+   * set the coordinates of the subspace, the values are copied, s.t. the
+   * array may change afterwards (no allocation if the dimension is the same)
+   *
+   * @param _index coordinates of the subspace in ascending order, size() values
+   */
+  void setIndex(const unsigned* _index) {
+    index.assign(_index,_index + size());
+  }
+
+  /// @return coordinates of the subspace, size() values
+  const unsigned* getIndex() const {
+    return index.empty() ? 0 : &index[0];
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return "moRealSubspaceNeighbor";
+  }
+
+  /**
+   * @param _neighbor a neighbor
+   * @return if _neighbor and this one are equals
+   */
+  virtual bool equals(moRealSubspaceNeighbor<Fitness>& _neighbor) const {
+    if(size() != _neighbor.size() || index != _neighbor.index) return false;
+    for(unsigned k=0;k<size();k++)
+      if(_neighbor[k] > operator[](k) + 1E-10 || _neighbor[k] < operator[](k) - 1E-10) return false;
+    return true;
+  }
+
+  /**
+   * Write object with its coordinates
+   * @param _os A std::ostream.
+   */
+  virtual void printOn(std::ostream& _os) const {
+    EO<Fitness>::printOn(_os);
+    _os << ' ' << size() << ' ';
+    for(unsigned k=0;k<size();k++) _os << index[k] << ':' << operator[](k) << ' ';
+  }
+
+  /**
+   * move the solution
+   * @param _solution a solution
+   */
+  virtual void move(EOT& _solution) {
+    for(unsigned k=0;k<size();k++) _solution[index[k]] += operator[](k);
+    _solution.invalidate();
+  }
+
+  /**
+   * move the solution back
+   * @param _solution a solution
+   */
+  virtual void moveBack(EOT& _solution) {
+    for(unsigned k=0;k<size();k++) _solution[index[k]] -= operator[](k);
+    _solution.invalidate();
+  }
+
+ protected:
+
+  /// coordinates of the subspace
+  std::vector<unsigned> index;
+
+};
+
+#endif
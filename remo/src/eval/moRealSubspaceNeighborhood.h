@@ -0,0 +1,218 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moRealSubspaceNeighborhood_h
+#define _moRealSubspaceNeighborhood_h
+
+#include <vector>
+#include <algorithm>
+#include "neighborhood/moNeighborhood.h"
+#include "utils/eoRndGenerators.h"
+#include "moRealSubspaceNeighbor.h"
+
+/**
+ * \file moRealSubspaceNeighborhood.h
+ * \class moRealSubspaceNeighborhood
+ *
+ * A neighborhood for very high dimensions: each iteration (init()) picks a
+ * random subspace of d coordinates, either d random coordinates or a random
+ * contiguous block, and the neighbors perturb only these coordinates by
+ * uniform offsets in [-eps,eps]. Drawing the subspace costs O(d) by a
+ * partial Fisher-Yates shuffle of a persistent permutation.
+ *
+ * With bounds the offsets are reflected at the bounds and clipped before
+ * the neighbors are handed out.
+ *
+ * @date: Oct. 2026
+ */
+template <class Fitness>
+class moRealSubspaceNeighborhood : virtual public moNeighborhood<moRealSubspaceNeighbor<Fitness> >
+{
+public:
+
+  typedef moRealSubspaceNeighbor<Fitness> Neighbor;
+
+  /**
+   * Define type of a solution corresponding to Neighbor
+   */
+  typedef typename Neighbor::EOT EOT;
+
+  /**
+   * Constructor
+   * @param _maxNumNeighbors
+   * @param _eps radius of the neighborhood
+   * @param _dim dimension of the subspace
+   * @param _rng random number generator (a private one for concurrent local searches)
+   */
+  moRealSubspaceNeighborhood(unsigned _maxNumNeighbors,double _eps,unsigned _dim,eoRng& _rng=rng)
+    : moNeighborhood<Neighbor>(),maxNumNeighbors(_maxNumNeighbors),eps(_eps),dim(_dim),numGenNeighbors(0),
+    random(_rng),generator(0.0,1.0,_rng),contiguous(false) { }
+
+  /**
+   * @param _contiguous whether the subspace is a contiguous block of coordinates
+   */
+  void setContiguous(bool _contiguous=true) {
+    contiguous = _contiguous;
+  }
+
+  /**
+   * keep the neighbors within bounds
+   *
+   * @param _lowerBound  lower bounds
+   * @param _upperBound  upper bounds
+   */
+  void setBounds(const std::vector<double>& _lowerBound,const std::vector<double>& _upperBound) {
+    lowerBound = _lowerBound;
+    upperBound = _upperBound;
+  }
+
+  /**
+   * @return coordinates of the current subspace
+   */
+  const std::vector<unsigned>& getIndex() const {
+    return index;
+  }
+
+  /**
+   * Test if it exist a neighbor
+   * @param _solution the solution to explore
+   * @return true if the neighborhood was not empty
+   */
+  virtual bool hasNeighbor(EOT& _solution) {
+    if(numGenNeighbors > maxNumNeighbors) {
+      numGenNeighbors = 0;
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Initialization of the neighborhood: a new subspace
+   * @param _solution the solution to explore
+   * @param _current the first neighbor
+   */
+  virtual void init(EOT& _solution, Neighbor& _current) {
+    numGenNeighbors = 0;
+    drawSubspace(_solution.size());
+    next(_solution,_current);
+  }
+
+  /**
+   * Give the next neighbor
+   * @param _solution the solution to explore
+   * @param _current the next neighbor
+   */
+  virtual void next(EOT& _solution, Neighbor& _current) {
+    unsigned d = index.size();
+    if(_current.size() != d) _current.resize(d);
+    _current.setIndex(&index[0]);
+    bool bounded = lowerBound.size() == _solution.size() && upperBound.size() == _solution.size();
+    for(unsigned k=0;k<d;k++) {
+      double v = (generator() - 0.5) * eps * 2;
+      if(bounded) {
+	unsigned i = index[k];
+	double lo = lowerBound[i], hi = upperBound[i], y = _solution[i] + v;
+	if(y < lo) y = 2 * lo - y;
+	else if(y > hi) y = 2 * hi - y;
+	v = std::min(std::max(y,lo),hi) - _solution[i];
+      }
+      _current[k] = v;
+    }
+    numGenNeighbors++;
+  }
+
+  /**
+   * Test if there is again a neighbor
+   * @param _solution the solution to explore
+   * @return true if there is again a neighbor not explored
+   */
+  virtual bool cont(EOT& _solution) {
+    return hasNeighbor(_solution);
+  }
+
+  /**
+   * Return the class Name
+   * @return the class name as a std::string
+   */
+  virtual std::string className() const {
+    return "moRealSubspaceNeighborhood";
+  }
+
+protected:
+
+  /**
+   * draw the coordinates of a new subspace of a solution of dimension _n
+   */
+  void drawSubspace(unsigned _n) {
+    unsigned d = std::min(dim,_n);
+    index.resize(d);
+    if(contiguous) {
+      unsigned start = random.random(_n - d + 1);
+      for(unsigned k=0;k<d;k++) index[k] = start + k;
+      return;
+    }
+    if(permutation.size() != _n) {
+      permutation.resize(_n);
+      for(unsigned i=0;i<_n;i++) permutation[i] = i;
+    }
+    for(unsigned k=0;k<d;k++) {
+      unsigned j = k + random.random(_n - k);
+      std::swap(permutation[k],permutation[j]);
+      index[k] = permutation[k];
+    }
+    // ascending coordinates for the memory access of move() and incremental evaluation
+    std::sort(index.begin(),index.end());
+  }
+
+  /// maximum number of neighbors
+  int maxNumNeighbors;
+
+  /// the radius of the boundary around a solution to be explored
+  double eps;
+
+  /// dimension of the subspace
+  unsigned dim;
+
+  /// number of generated neighbors
+  int numGenNeighbors;
+
+  /// random number generator
+  eoRng& random;
+
+  /// uniform generator
+  eoUniformGenerator<double> generator;
+
+  /// whether the subspace is a contiguous block
+  bool contiguous;
+
+  /// coordinates of the current subspace
+  std::vector<unsigned> index;
+
+  /// permutation of the coordinates, its first d entries are the subspace
+  std::vector<unsigned> permutation;
+
+  /// lower bounds of the neighbors
+  std::vector<double> lowerBound;
+
+  /// upper bounds of the neighbors
+  std::vector<double> upperBound;
+};
+
+#endif
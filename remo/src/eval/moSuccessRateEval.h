@@ -0,0 +1,70 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moSuccessRateEval_h
+#define _moSuccessRateEval_h
+
+#include "eval/moEval.h"
+
+/**
+ * \file  moSuccessRateEval.h
+ * \class moSuccessRateEval
+ *
+ * Neighbor evaluation decorator reporting the fitness of each evaluated 
+ * neighbor together with the fitness of its solution to an observer, e.g. 
+ * the success rule of an adaptive neighborhood 
+ * (@see moRealAdaptiveNeighborhood::observe). 
+ *
+ * @date: Oct. 2026
+ */
+template<class Neighbor,class Observer>
+class moSuccessRateEval : public moEval<Neighbor> {
+
+public:
+
+  typedef typename moEval<Neighbor>::EOT EOT;
+
+  /**
+   * Cor
+   *
+   * @param _eval      wrapped neighbor evaluation
+   * @param _observer  receives the outcome of each evaluation
+   */
+  moSuccessRateEval(moEval<Neighbor>& _eval,Observer& _observer) : eval(_eval),observer(_observer) { }
+
+  /**
+   * evaluate a neighbor and report the outcome
+   *
+   * @param _solution  current solution
+   * @param _neighbor  neighbor to evaluate
+   */
+  virtual void operator()(EOT& _solution,Neighbor& _neighbor) {
+    eval(_solution,_neighbor);
+    if(!_solution.invalid() && !_neighbor.invalid()) 
+      observer.observe(_solution.fitness(),_neighbor.fitness());
+  }
+
+ protected:
+
+  moEval<Neighbor>&  eval;      ///> wrapped neighbor evaluation
+  Observer&          observer;  ///> observer of the outcomes
+};
+
+#endif
@@ -0,0 +1,321 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _moSurrogate_h
+#define _moSurrogate_h
+
+#include <vector>
+#include <cmath>
+#include <string>
+
+#include "util/LinearAlgebra.h"
+
+/**
+ * \file  moSurrogate.h
+ * \class moSurrogate
+ *
+ * Cheap model of the objective function trained on the archive of truly
+ * evaluated points. It is used to pre-screen candidate solutions, s.t. only
+ * the most promising ones are evaluated by the objective function.
+ * The models are updated incrementally on each true evaluation.
+ * add() is not thread-safe, predict() can be called concurrently.
+ *
+ * @date: Oct. 2026
+ */
+class moSurrogate {
+
+public:
+
+  /**
+   * Cor.
+   *
+   * @param _minPoints number of archived points before the model is used
+   */
+  moSurrogate(unsigned int _minPoints) : minPoints(_minPoints) { }
+
+  /// Destructor
+  virtual ~moSurrogate() { }
+
+  /**
+   * add a truly evaluated point to the archive and update the model
+   *
+   * @param _x  point
+   * @param _f  its objective value
+   */
+  virtual void add(const std::vector<double>& _x,double _f)=0;
+
+  /**
+   * @param _x point
+   * @return predicted objective value
+   */
+  virtual double predict(const std::vector<double>& _x) const=0;
+
+  /// @return number of points the model is trained on
+  virtual unsigned int size() const=0;
+
+  /// @return whether the model has enough points to be used
+  virtual bool ready() const {
+    return size() > 0 && size() >= minPoints;
+  }
+
+  /// set the number of archived points before the model is used
+  void setMinPoints(unsigned int _minPoints) {
+    minPoints = _minPoints;
+  }
+
+  /// @return the class name
+  virtual std::string className() const {
+    return "moSurrogate";
+  }
+
+ protected:
+
+  unsigned int minPoints;  ///> number of archived points before the model is used
+};
+
+
+/**
+ * \class moRBFSurrogate
+ *
+ * Gaussian radial basis function interpolation with a constant trend over a
+ * sliding window of the most recent points. Each new point extends the packed
+ * Cholesky factor of the kernel matrix in O(m^2). When the window is full the
+ * older half is dropped and the model is refitted, the kernel width is then
+ * re-estimated from the spread of the remaining points (if not fixed).
+ */
+class moRBFSurrogate : public moSurrogate {
+
+public:
+
+  /**
+   * Cor.
+   *
+   * @param _maxPoints  size of the sliding window
+   * @param _width      kernel width (0: estimated from the data)
+   * @param _minPoints  number of archived points before the model is used
+   */
+  moRBFSurrogate(unsigned int _maxPoints=200,double _width=0.0,unsigned int _minPoints=10)
+    : moSurrogate(_minPoints),maxPoints(_maxPoints < 4 ? 4 : _maxPoints),
+    fixedWidth(_width),width(_width),nugget(1e-8),n(0),m(0),ymean(0.0) { }
+
+  virtual void add(const std::vector<double>& _x,double _f) {
+    if(n == 0) n = _x.size();
+    if(!(_f == _f) || std::fabs(_f) == HUGE_VAL) return;   // NaN, inf
+    if(m == maxPoints) {
+      // keep the most recent half of the window
+      unsigned int keep = maxPoints / 2;
+      xs.erase(xs.begin(),xs.begin() + (m-keep)*n);
+      ys.erase(ys.begin(),ys.begin() + (m-keep));
+      m = keep;
+      refit();
+    }
+    xs.insert(xs.end(),_x.begin(),_x.end());
+    ys.push_back(_f);
+    m++;
+    if(width <= 0.0) {
+      // the kernel width is fixed once the model is ready
+      if(m >= minPoints) refit();
+      return;
+    }
+    std::vector<double> k(m-1);
+    for(unsigned int i=0;i+1<m;i++) k[i] = kernel(&xs[i*n],&_x[0]);
+    if(!LinearAlgebra::choleskyAppendPacked(Lp,m-1,k.empty() ? 0 : &k[0],1.0+nugget)) {
+      // numerically a duplicate point
+      xs.resize((m-1)*n);
+      ys.pop_back();
+      m--;
+      return;
+    }
+    solve();
+  }
+
+  virtual double predict(const std::vector<double>& _x) const {
+    double s = ymean;
+    for(unsigned int i=0;i<w.size();i++)
+      s += w[i] * kernel(&xs[i*n],&_x[0]);
+    return s;
+  }
+
+  virtual unsigned int size() const {
+    return w.size();
+  }
+
+  virtual std::string className() const {
+    return "moRBFSurrogate";
+  }
+
+ protected:
+
+  /// Gaussian kernel
+  double kernel(const double* _a,const double* _b) const {
+    double d = 0.0;
+    for(unsigned int j=0;j<n;j++) {
+      double t = _a[j] - _b[j];
+      d += t * t;
+    }
+    return std::exp(-0.5 * d / (width * width));
+  }
+
+  /// rebuild the factor from the archived window
+  void refit() {
+    if(fixedWidth <= 0.0) {
+      // mean distance of the points to their centroid
+      std::vector<double> c(n,0.0);
+      for(unsigned int i=0;i<m;i++)
+	for(unsigned int j=0;j<n;j++) c[j] += xs[i*n+j] / m;
+      double r = 0.0;
+      for(unsigned int i=0;i<m;i++) {
+	double d = 0.0;
+	for(unsigned int j=0;j<n;j++) d += (xs[i*n+j]-c[j]) * (xs[i*n+j]-c[j]);
+	r += std::sqrt(d) / m;
+      }
+      width = r > 0.0 ? r : 1.0;
+    }
+    std::vector<double> X,Y;
+    X.swap(xs);
+    Y.swap(ys);
+    Lp.clear();
+    unsigned int mm = m;
+    m = 0;
+    std::vector<double> k(mm+1);
+    for(unsigned int p=0;p<mm;p++) {
+      const double* x = &X[p*n];
+      for(unsigned int i=0;i<m;i++) k[i] = kernel(&xs[i*n],x);
+      if(LinearAlgebra::choleskyAppendPacked(Lp,m,&k[0],1.0+nugget)) {
+	xs.insert(xs.end(),x,x+n);
+	ys.push_back(Y[p]);
+	m++;
+      }
+    }
+    solve();
+  }
+
+  /// weights w = K^-1 (y - ymean)
+  void solve() {
+    ymean = 0.0;
+    for(unsigned int i=0;i<m;i++) ymean += ys[i] / m;
+    w.resize(m);
+    for(unsigned int i=0;i<m;i++) w[i] = ys[i] - ymean;
+    if(m > 0) LinearAlgebra::choleskySolvePacked(&Lp[0],m,&w[0]);
+  }
+
+  unsigned int        maxPoints;   ///> size of the sliding window
+  double              fixedWidth;  ///> user specified kernel width (0: estimated)
+  double              width;       ///> kernel width
+  double              nugget;      ///> regularization of the kernel matrix
+  unsigned int        n;           ///> dimension
+  unsigned int        m;           ///> number of points in the window
+  std::vector<double> xs;          ///> points (m x n)
+  std::vector<double> ys;          ///> objective values
+  std::vector<double> Lp;          ///> packed Cholesky factor of the kernel matrix
+  std::vector<double> w;           ///> interpolation weights
+  double              ymean;       ///> constant trend
+};
+
+
+/**
+ * \class moQuadraticSurrogate
+ *
+ * Local separable quadratic model f(x) = c + sum_i b_i d_i + a_i d_i^2 with
+ * d = x - x0, fitted by recursive least squares with exponential forgetting,
+ * s.t. recent points around the current search region dominate.
+ * Each update costs O(n^2) independently of the archive size.
+ */
+class moQuadraticSurrogate : public moSurrogate {
+
+public:
+
+  /**
+   * Cor.
+   *
+   * @param _forgetting  forgetting factor in ]0,1]
+   * @param _minPoints   number of archived points before the model is used (0: 2n+1)
+   */
+  moQuadraticSurrogate(double _forgetting=0.99,unsigned int _minPoints=0)
+    : moSurrogate(_minPoints),lambda(_forgetting),n(0),p(0),count(0) { }
+
+  virtual void add(const std::vector<double>& _x,double _f) {
+    if(!(_f == _f) || std::fabs(_f) == HUGE_VAL) return;
+    if(n == 0) {
+      n = _x.size();
+      p = 2*n + 1;
+      x0 = _x;
+      theta.assign(p,0.0);
+      P.assign(p*p,0.0);
+      for(unsigned int i=0;i<p;i++) P[i*p+i] = 1e6;
+      phi.resize(p);
+      Pphi.resize(p);
+      if(minPoints == 0) minPoints = p;
+    }
+    features(_x,&phi[0]);
+    LinearAlgebra::multAx(&P[0],&phi[0],&Pphi[0],p,p);
+    double denom = lambda + LinearAlgebra::dot(&phi[0],&Pphi[0],p);
+    double err = _f - LinearAlgebra::dot(&theta[0],&phi[0],p);
+    for(unsigned int i=0;i<p;i++) theta[i] += Pphi[i] / denom * err;
+    // P = (P - Pphi Pphi^T / denom) / lambda
+    for(unsigned int i=0;i<p;i++) {
+      double a = Pphi[i] / denom;
+      double* Pi = &P[i*p];
+      for(unsigned int j=0;j<p;j++) Pi[j] = (Pi[j] - a * Pphi[j]) / lambda;
+    }
+    count++;
+  }
+
+  virtual double predict(const std::vector<double>& _x) const {
+    double s = theta[0];
+    for(unsigned int i=0;i<n;i++) {
+      double d = _x[i] - x0[i];
+      s += theta[1+i] * d + theta[1+n+i] * d * d;
+    }
+    return s;
+  }
+
+  virtual unsigned int size() const {
+    return count;
+  }
+
+  virtual std::string className() const {
+    return "moQuadraticSurrogate";
+  }
+
+ protected:
+
+  /// feature vector (1, d, d^2)
+  void features(const std::vector<double>& _x,double* _phi) const {
+    _phi[0] = 1.0;
+    for(unsigned int i=0;i<n;i++) {
+      double d = _x[i] - x0[i];
+      _phi[1+i] = d;
+      _phi[1+n+i] = d * d;
+    }
+  }
+
+  double              lambda;  ///> forgetting factor
+  unsigned int        n;       ///> dimension
+  unsigned int        p;       ///> number of coefficients
+  unsigned long       count;   ///> number of added points
+  std::vector<double> x0;      ///> center of the model
+  std::vector<double> theta;   ///> coefficients
+  std::vector<double> P;       ///> inverse correlation matrix (p x p)
+  std::vector<double> phi;     ///> feature vector
+  std::vector<double> Pphi;    ///> P * phi
+};
+
+#endif
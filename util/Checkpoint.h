@@ -0,0 +1,379 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _Checkpoint_h
+#define _Checkpoint_h
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/**
+ * \file Checkpoint.h
+ * \class Checkpoint
+ *
+ * Compact versioned binary snapshot of a run: the incumbent solution or the
+ * population with fitnesses, the state of the random number generator and
+ * the counters of evaluations and iterations / generations.
+ *
+ * Layout (native byte order) :
+ *   char[8] magic "BBPEOCKP", uint32 version, uint32 kind,
+ *   uint64 evaluations, uint64 steps,
+ *   uint32 length + bytes of the random number generator state,
+ *   uint32 number of solutions, uint32 dimension,
+ *   per solution : uint8 valid, double fitness, double[dimension] values
+ *
+ * Files are written to a temporary file first and renamed, s.t. a crash
+ * during writing never destroys the previous checkpoint.
+ *
+ * @date: Oct. 2026
+ */
+class Checkpoint {
+
+public:
+
+  /** file format version */
+  static const unsigned int VERSION = 1;
+
+  /** kind of the run */
+  enum Kind { LOCALSEARCH = 1, POPULATION = 2 };
+
+  Kind                 kind;         ///> kind of the run
+  unsigned long long   evaluations;  ///> number of function evaluations
+  unsigned long long   steps;        ///> number of iterations / generations
+  std::string          rngState;     ///> serialized random number generator
+  unsigned int         dimension;    ///> dimension of the solutions
+  std::vector<char>    valid;        ///> whether the fitness is valid
+  std::vector<double>  fitness;      ///> fitnesses
+  std::vector<double>  values;       ///> solutions (size x dimension)
+
+  /// Cor.
+  Checkpoint() : kind(LOCALSEARCH),evaluations(0),steps(0),dimension(0) { }
+
+  /// @return number of solutions
+  unsigned int size() const {
+    return fitness.size();
+  }
+
+  /**
+   * append a solution (e.g. EORVT)
+   */
+  template<class EOT>
+  void addSolution(const EOT& _sol) {
+    dimension = _sol.size();
+    valid.push_back(!_sol.invalid());
+    fitness.push_back(_sol.invalid() ? 0.0 : (double) _sol.fitness());
+    for(unsigned int j=0;j<dimension;j++) values.push_back(_sol[j]);
+  }
+
+  /**
+   * restore the i-th solution
+   */
+  template<class EOT>
+  void getSolution(unsigned int _i,EOT& _sol) const {
+    _sol.resize(dimension);
+    for(unsigned int j=0;j<dimension;j++) _sol[j] = values[_i*dimension+j];
+    if(valid[_i]) _sol.fitness(fitness[_i]);
+    else _sol.invalidate();
+  }
+
+  /**
+   * store the state of a random number generator (e.g. eoRng)
+   */
+  template<class RNG>
+  void setRng(const RNG& _rng) {
+    std::ostringstream os;
+    os.precision(17);
+    _rng.printOn(os);
+    rngState = os.str();
+  }
+
+  /**
+   * restore the state of a random number generator
+   */
+  template<class RNG>
+  void getRng(RNG& _rng) const {
+    if(rngState.empty()) return;
+    std::istringstream is(rngState);
+    _rng.readFrom(is);
+  }
+
+  /**
+   * serialize into a byte buffer
+   */
+  void serialize(std::vector<char>& _buffer) const {
+    _buffer.clear();
+    _buffer.insert(_buffer.end(),MAGIC(),MAGIC()+8);
+    put(_buffer,(unsigned int) VERSION);
+    put(_buffer,(unsigned int) kind);
+    put(_buffer,evaluations);
+    put(_buffer,steps);
+    put(_buffer,(unsigned int) rngState.size());
+    _buffer.insert(_buffer.end(),rngState.begin(),rngState.end());
+    put(_buffer,size());
+    put(_buffer,dimension);
+    for(unsigned int i=0;i<size();i++) {
+      _buffer.push_back(valid[i]);
+      put(_buffer,fitness[i]);
+      const char* v = (const char*) &values[i*dimension];
+      _buffer.insert(_buffer.end(),v,v+dimension*sizeof(double));
+    }
+  }
+
+  /**
+   * deserialize from a byte buffer
+   *
+   * @return false if the buffer is not a valid checkpoint
+   */
+  bool deserialize(const std::vector<char>& _buffer) {
+    const char* p = _buffer.empty() ? 0 : &_buffer[0];
+    const char* end = p + _buffer.size();
+    unsigned int version,k,len,num;
+    if(_buffer.size() < 8 || std::memcmp(p,MAGIC(),8) != 0) return false;
+    p += 8;
+    if(!get(p,end,version) || version != VERSION) return false;
+    if(!get(p,end,k) || !get(p,end,evaluations) || !get(p,end,steps) || !get(p,end,len)) return false;
+    if((unsigned long) (end-p) < len) return false;
+    kind = (Kind) k;
+    rngState.assign(p,p+len);
+    p += len;
+    if(!get(p,end,num) || !get(p,end,dimension)) return false;
+    if((unsigned long) (end-p) != (unsigned long) num * (1 + sizeof(double) * (1 + dimension))) return false;
+    valid.resize(num);
+    fitness.resize(num);
+    values.resize((unsigned long) num*dimension);
+    for(unsigned int i=0;i<num;i++) {
+      valid[i] = *p++;
+      get(p,end,fitness[i]);
+      if(dimension > 0) std::memcpy(&values[i*dimension],p,dimension*sizeof(double));
+      p += dimension*sizeof(double);
+    }
+    return true;
+  }
+
+  /**
+   * write a serialized checkpoint atomically (temporary file and rename)
+   *
+   * @return false on i/o errors
+   */
+  static bool writeFile(const std::string& _file,const std::vector<char>& _buffer) {
+    std::string tmp = _file + ".tmp";
+    FILE* f = std::fopen(tmp.c_str(),"wb");
+    if(f == 0) return false;
+    bool ok = _buffer.empty() || std::fwrite(&_buffer[0],1,_buffer.size(),f) == _buffer.size();
+    ok = std::fflush(f) == 0 && ok;
+#ifndef _WIN32
+    ok = fsync(fileno(f)) == 0 && ok;
+#else
+    // rename does not replace existing files on windows
+    if(ok) std::remove(_file.c_str());
+#endif
+    ok = std::fclose(f) == 0 && ok;
+    if(!ok || std::rename(tmp.c_str(),_file.c_str()) != 0) {
+      std::remove(tmp.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * write the checkpoint atomically
+   */
+  bool save(const std::string& _file) const {
+    std::vector<char> buffer;
+    serialize(buffer);
+    return writeFile(_file,buffer);
+  }
+
+  /**
+   * read a checkpoint
+   *
+   * @return false if the file does not exist or is not a valid checkpoint
+   */
+  bool load(const std::string& _file) {
+    FILE* f = std::fopen(_file.c_str(),"rb");
+    if(f == 0) return false;
+    std::vector<char> buffer;
+    char chunk[65536];
+    size_t n;
+    while((n = std::fread(chunk,1,sizeof(chunk),f)) > 0)
+      buffer.insert(buffer.end(),chunk,chunk+n);
+    std::fclose(f);
+    return deserialize(buffer);
+  }
+
+ private:
+
+  static const char* MAGIC() {
+    return "BBPEOCKP";
+  }
+
+  template<class T>
+  static void put(std::vector<char>& _buffer,const T& _v) {
+    const char* c = (const char*) &_v;
+    _buffer.insert(_buffer.end(),c,c+sizeof(T));
+  }
+
+  template<class T>
+  static bool get(const char*& _p,const char* _end,T& _v) {
+    if((unsigned long) (_end-_p) < sizeof(T)) return false;
+    std::memcpy(&_v,_p,sizeof(T));
+    _p += sizeof(T);
+    return true;
+  }
+};
+
+
+/**
+ * \class CheckpointWriter
+ *
+ * Writes serialized checkpoints in a background thread, s.t. the search
+ * only pays for copying the snapshot. If the writer is still busy, the
+ * pending snapshot is replaced by the newer one. Without POSIX threads
+ * (windows) the checkpoints are written synchronously.
+ */
+class CheckpointWriter {
+
+public:
+
+  /**
+   * Cor.
+   *
+   * @param _file        checkpoint file
+   * @param _background  whether the file is written in a background thread
+   */
+  CheckpointWriter(const std::string& _file,bool _background=true)
+    : file(_file),background(_background),started(false),pending(false),writing(false),stop(false),numWritten(0) {
+#ifndef _WIN32
+    pthread_mutex_init(&mutex,0);
+    pthread_cond_init(&cond,0);
+#else
+    background = false;
+#endif
+  }
+
+  /// Destructor, the pending checkpoint is written
+  ~CheckpointWriter() {
+#ifndef _WIN32
+    if(started) {
+      pthread_mutex_lock(&mutex);
+      stop = true;
+      pthread_cond_broadcast(&cond);
+      pthread_mutex_unlock(&mutex);
+      pthread_join(thread,0);
+    }
+    pthread_cond_destroy(&cond);
+    pthread_mutex_destroy(&mutex);
+#endif
+  }
+
+  /**
+   * hand over a checkpoint to the writer
+   *
+   * @param _buffer serialized checkpoint, its content is swapped away
+   */
+  void write(std::vector<char>& _buffer) {
+#ifndef _WIN32
+    if(background) {
+      pthread_mutex_lock(&mutex);
+      if(!started)
+	started = pthread_create(&thread,0,&CheckpointWriter::run,this) == 0;
+      if(started) {
+	buffer.swap(_buffer);
+	pending = true;
+	pthread_cond_broadcast(&cond);
+	pthread_mutex_unlock(&mutex);
+	return;
+      }
+      pthread_mutex_unlock(&mutex);
+    }
+#endif
+    if(Checkpoint::writeFile(file,_buffer)) numWritten++;
+  }
+
+  /**
+   * block until the pending checkpoint is written
+   */
+  void flush() {
+#ifndef _WIN32
+    pthread_mutex_lock(&mutex);
+    while(pending || writing) pthread_cond_wait(&cond,&mutex);
+    pthread_mutex_unlock(&mutex);
+#endif
+  }
+
+  /// @return number of written checkpoints
+  unsigned long getNumWritten() const {
+    return numWritten;
+  }
+
+  /// @return the checkpoint file
+  const std::string& getFile() const {
+    return file;
+  }
+
+ private:
+
+#ifndef _WIN32
+  /// writer thread
+  static void* run(void* _self) {
+    CheckpointWriter* self = (CheckpointWriter*) _self;
+    std::vector<char> local;
+    pthread_mutex_lock(&self->mutex);
+    for(;;) {
+      while(!self->pending && !self->stop) pthread_cond_wait(&self->cond,&self->mutex);
+      if(!self->pending) break;
+      local.swap(self->buffer);
+      self->pending = false;
+      self->writing = true;
+      pthread_mutex_unlock(&self->mutex);
+      bool ok = Checkpoint::writeFile(self->file,local);
+      pthread_mutex_lock(&self->mutex);
+      if(ok) self->numWritten++;
+      self->writing = false;
+      pthread_cond_broadcast(&self->cond);
+    }
+    pthread_mutex_unlock(&self->mutex);
+    return 0;
+  }
+
+  pthread_t          thread;      ///> writer thread
+  pthread_mutex_t    mutex;       ///> guards buffer and flags
+  pthread_cond_t     cond;        ///> signals new snapshots and written files
+#endif
+
+  std::string        file;        ///> checkpoint file
+  bool               background;  ///> whether a writer thread is used
+  bool               started;     ///> whether the writer thread runs
+  bool               pending;     ///> whether a snapshot waits for writing
+  bool               writing;     ///> whether a snapshot is being written
+  bool               stop;        ///> terminate the writer thread
+  std::vector<char>  buffer;      ///> pending snapshot
+  unsigned long      numWritten;  ///> number of written checkpoints
+};
+
+#endif
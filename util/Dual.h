@@ -0,0 +1,256 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _Dual_h
+#define _Dual_h
+
+#include <cmath>
+#include <ostream>
+
+/**
+ * \file Dual.h
+ * \class Dual
+ *
+ * Dual number for forward mode automatic differentiation carrying N tangent
+ * directions at once: x = v + sum_k d_k e_k with e_k e_l = 0. Evaluating a
+ * function written for a generic scalar type with Dual<N> arguments yields
+ * its value and N directional derivatives in a single pass. The loops over
+ * the tangents have the constant length N, s.t. the compiler can vectorize
+ * them (-O3).
+ *
+ * Comparisons only consider the value, the derivatives of piecewise defined
+ * functions are those of the active piece.
+ *
+ * @date: Oct. 2026
+ */
+template<int N>
+class Dual {
+
+public:
+
+  /// Cor. of the constant 0
+  Dual() : v(0.0) {
+    for(int k=0;k<N;k++) d[k] = 0.0;
+  }
+
+  /// Cor. of a constant
+  Dual(double _v) : v(_v) {
+    for(int k=0;k<N;k++) d[k] = 0.0;
+  }
+
+  /**
+   * Cor. of an independent variable
+   *
+   * @param _v  value
+   * @param _k  tangent direction of the variable (out of [0,N[: none)
+   */
+  Dual(double _v,int _k) : v(_v) {
+    seed(_k);
+  }
+
+  /// set the tangents to the _k-th unit direction (out of [0,N[: zero)
+  void seed(int _k) {
+    for(int k=0;k<N;k++) d[k] = (k == _k) ? 1.0 : 0.0;
+  }
+
+  /// @return the value
+  double value() const {
+    return v;
+  }
+
+  /// @return the derivative in the _k-th direction
+  double tangent(int _k) const {
+    return d[_k];
+  }
+
+  /// @return true if all tangents are zero
+  bool isConstant() const {
+    for(int k=0;k<N;k++)
+      if(d[k] != 0.0) return false;
+    return true;
+  }
+
+  Dual& operator+=(const Dual& _b) {
+    v += _b.v;
+    for(int k=0;k<N;k++) d[k] += _b.d[k];
+    return *this;
+  }
+
+  Dual& operator-=(const Dual& _b) {
+    v -= _b.v;
+    for(int k=0;k<N;k++) d[k] -= _b.d[k];
+    return *this;
+  }
+
+  Dual& operator*=(const Dual& _b) {
+    for(int k=0;k<N;k++) d[k] = d[k] * _b.v + v * _b.d[k];
+    v *= _b.v;
+    return *this;
+  }
+
+  Dual& operator/=(const Dual& _b) {
+    double inv = 1.0 / _b.v;
+    v *= inv;
+    for(int k=0;k<N;k++) d[k] = (d[k] - v * _b.d[k]) * inv;
+    return *this;
+  }
+
+  Dual& operator+=(double _b) {
+    v += _b;
+    return *this;
+  }
+
+  Dual& operator-=(double _b) {
+    v -= _b;
+    return *this;
+  }
+
+  Dual& operator*=(double _b) {
+    v *= _b;
+    for(int k=0;k<N;k++) d[k] *= _b;
+    return *this;
+  }
+
+  Dual& operator/=(double _b) {
+    return *this *= 1.0 / _b;
+  }
+
+  /**
+   * chain rule: f(x) with f(v) = _f and f'(v) = _df
+   */
+  Dual chain(double _f,double _df) const {
+    Dual r(_f);
+    for(int k=0;k<N;k++) r.d[k] = _df * d[k];
+    return r;
+  }
+
+  double v;     ///> value
+  double d[N];  ///> derivatives in the tangent directions
+};
+
+template<int N> inline Dual<N> operator+(const Dual<N>& _a) { return _a; }
+template<int N> inline Dual<N> operator-(const Dual<N>& _a) { return _a.chain(-_a.v,-1.0); }
+
+template<int N> inline Dual<N> operator+(Dual<N> _a,const Dual<N>& _b) { return _a += _b; }
+template<int N> inline Dual<N> operator-(Dual<N> _a,const Dual<N>& _b) { return _a -= _b; }
+template<int N> inline Dual<N> operator*(Dual<N> _a,const Dual<N>& _b) { return _a *= _b; }
+template<int N> inline Dual<N> operator/(Dual<N> _a,const Dual<N>& _b) { return _a /= _b; }
+
+template<int N> inline Dual<N> operator+(Dual<N> _a,double _b) { return _a += _b; }
+template<int N> inline Dual<N> operator-(Dual<N> _a,double _b) { return _a -= _b; }
+template<int N> inline Dual<N> operator*(Dual<N> _a,double _b) { return _a *= _b; }
+template<int N> inline Dual<N> operator/(Dual<N> _a,double _b) { return _a /= _b; }
+
+template<int N> inline Dual<N> operator+(double _a,Dual<N> _b) { return _b += _a; }
+template<int N> inline Dual<N> operator-(double _a,const Dual<N>& _b) { return _b.chain(_a - _b.v,-1.0); }
+template<int N> inline Dual<N> operator*(double _a,Dual<N> _b) { return _b *= _a; }
+template<int N> inline Dual<N> operator/(double _a,const Dual<N>& _b) {
+  double r = _a / _b.v;
+  return _b.chain(r,-r / _b.v);
+}
+
+template<int N> inline bool operator<(const Dual<N>& _a,const Dual<N>& _b)  { return _a.v < _b.v; }
+template<int N> inline bool operator>(const Dual<N>& _a,const Dual<N>& _b)  { return _a.v > _b.v; }
+template<int N> inline bool operator<=(const Dual<N>& _a,const Dual<N>& _b) { return _a.v <= _b.v; }
+template<int N> inline bool operator>=(const Dual<N>& _a,const Dual<N>& _b) { return _a.v >= _b.v; }
+template<int N> inline bool operator==(const Dual<N>& _a,const Dual<N>& _b) { return _a.v == _b.v; }
+template<int N> inline bool operator!=(const Dual<N>& _a,const Dual<N>& _b) { return _a.v != _b.v; }
+template<int N> inline bool operator<(const Dual<N>& _a,double _b)  { return _a.v < _b; }
+template<int N> inline bool operator>(const Dual<N>& _a,double _b)  { return _a.v > _b; }
+template<int N> inline bool operator<=(const Dual<N>& _a,double _b) { return _a.v <= _b; }
+template<int N> inline bool operator>=(const Dual<N>& _a,double _b) { return _a.v >= _b; }
+template<int N> inline bool operator<(double _a,const Dual<N>& _b)  { return _a < _b.v; }
+template<int N> inline bool operator>(double _a,const Dual<N>& _b)  { return _a > _b.v; }
+template<int N> inline bool operator<=(double _a,const Dual<N>& _b) { return _a <= _b.v; }
+template<int N> inline bool operator>=(double _a,const Dual<N>& _b) { return _a >= _b.v; }
+
+// elementary functions, found by argument dependent lookup of unqualified calls
+
+template<int N> inline Dual<N> sqrt(const Dual<N>& _a) {
+  double s = std::sqrt(_a.v);
+  return _a.chain(s,s > 0.0 ? 0.5 / s : 0.0);
+}
+
+template<int N> inline Dual<N> exp(const Dual<N>& _a) {
+  double e = std::exp(_a.v);
+  return _a.chain(e,e);
+}
+
+template<int N> inline Dual<N> log(const Dual<N>& _a) {
+  return _a.chain(std::log(_a.v),1.0 / _a.v);
+}
+
+template<int N> inline Dual<N> sin(const Dual<N>& _a) {
+  return _a.chain(std::sin(_a.v),std::cos(_a.v));
+}
+
+template<int N> inline Dual<N> cos(const Dual<N>& _a) {
+  return _a.chain(std::cos(_a.v),-std::sin(_a.v));
+}
+
+template<int N> inline Dual<N> tan(const Dual<N>& _a) {
+  double t = std::tan(_a.v);
+  return _a.chain(t,1.0 + t * t);
+}
+
+template<int N> inline Dual<N> atan(const Dual<N>& _a) {
+  return _a.chain(std::atan(_a.v),1.0 / (1.0 + _a.v * _a.v));
+}
+
+template<int N> inline Dual<N> tanh(const Dual<N>& _a) {
+  double t = std::tanh(_a.v);
+  return _a.chain(t,1.0 - t * t);
+}
+
+template<int N> inline Dual<N> fabs(const Dual<N>& _a) {
+  return _a.v < 0.0 ? -_a : _a;
+}
+
+template<int N> inline Dual<N> abs(const Dual<N>& _a) {
+  return fabs(_a);
+}
+
+// at 0 the derivative of x^p, p < 1, is infinite and taken as 0 (as for
+// sqrt), s.t. the tangents of an argument at 0 stay finite
+template<int N> inline Dual<N> pow(const Dual<N>& _a,double _p) {
+  if(_a.v == 0.0)
+    return _a.chain(std::pow(_a.v,_p),_p == 1.0 ? 1.0 : 0.0);
+  return _a.chain(std::pow(_a.v,_p),_p * std::pow(_a.v,_p - 1.0));
+}
+
+// exp(p log(a)) is only defined for a > 0, a constant exponent takes the
+// path of std::pow (e.g. x^4 of a negative x)
+template<int N> inline Dual<N> pow(const Dual<N>& _a,const Dual<N>& _p) {
+  if(_p.isConstant()) return pow(_a,_p.v);
+  return exp(_p * log(_a));
+}
+
+template<int N> inline Dual<N> pow(double _a,const Dual<N>& _p) {
+  double r = std::pow(_a,_p.v);
+  return _p.chain(r,r * std::log(_a));
+}
+
+template<int N> inline std::ostream& operator<<(std::ostream& _os,const Dual<N>& _a) {
+  _os << _a.v << " [";
+  for(int k=0;k<N;k++) _os << (k ? " " : "") << _a.d[k];
+  return _os << "]";
+}
+
+#endif
@@ -0,0 +1,296 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _EvalArchive_h
+#define _EvalArchive_h
+
+#include <vector>
+#include <string>
+#include <cstring>
+
+#include "MappedFile.h"
+
+/**
+ * \file EvalArchive.h
+ * \class EvalArchive
+ *
+ * Append-only archive of evaluated points in a memory mapped file.
+ * Each record holds the parameter vector, the fitness, the wall clock time,
+ * the id of the worker thread and the algorithm step (iteration / generation).
+ *
+ * The file consists of a header block and chunks of chunkRecords records,
+ * stored column-wise within a chunk :
+ *   x_0[C] ... x_{n-1}[C] fitness[C] time[C] step[C] worker[C] committed[C]
+ * The file grows by one chunk at a time, each chunk is mapped separately s.t.
+ * concurrent writers never see a remapped region. Writers reserve records by
+ * an atomic increment of the cursor in the header and mark them committed
+ * after writing, thus a separate process can read the archive while the run
+ * is live (records not yet committed are skipped).
+ * Reopening an existing archive with the same dimension appends to it.
+ *
+ * @date: Oct. 2026
+ */
+class EvalArchive {
+
+public:
+
+  /** file format version */
+  static const unsigned int VERSION = 1;
+
+  /** maximum number of chunks */
+  static const unsigned int MAX_CHUNKS = 65536;
+
+  /// Cor.
+  EvalArchive() : header(0),writable(false),dimension(0),chunkRecords(0),chunkBytes(0) { }
+
+  /// Destructor
+  ~EvalArchive() {
+    close();
+  }
+
+  /**
+   * open an archive for appending, it is created if it does not exist
+   *
+   * @param _path          file name
+   * @param _dimension     dimension of the parameter vectors
+   * @param _chunkRecords  number of records per chunk of a new archive
+   * @return false on failure or if an existing archive has another dimension
+   */
+  bool create(const std::string& _path,unsigned int _dimension,unsigned int _chunkRecords=4096) {
+    close();
+    writable = true;
+    if(!file.open(_path,true)) return false;
+    bool exists = file.size() >= MappedFile::ALIGNMENT;
+    if(!exists && !file.grow(MappedFile::ALIGNMENT)) return false;
+    header = (Header*) file.map(0,MappedFile::ALIGNMENT);
+    if(header == 0) return false;
+    if(exists) {
+      if(!readHeader() || dimension != _dimension) {
+	close();
+	return false;
+      }
+      return true;
+    }
+    std::memset(header,0,sizeof(Header));
+    header->version = VERSION;
+    header->dimension = _dimension;
+    header->chunkRecords = _chunkRecords > 0 ? _chunkRecords : 4096;
+    header->chunkBytes = bytesPerChunk(_dimension,header->chunkRecords);
+    header->count = 0;
+    __sync_synchronize();
+    std::memcpy(header->magic,MAGIC(),8);
+    return readHeader();
+  }
+
+  /**
+   * open an archive for reading, possibly while another process appends
+   *
+   * @param _path file name
+   * @return false on failure
+   */
+  bool open(const std::string& _path) {
+    close();
+    writable = false;
+    if(!file.open(_path,false) || file.size() < MappedFile::ALIGNMENT) return false;
+    header = (Header*) file.map(0,MappedFile::ALIGNMENT);
+    if(header == 0 || !readHeader()) {
+      close();
+      return false;
+    }
+    return true;
+  }
+
+  /// flush and unmap
+  void close() {
+    for(unsigned int c=0;c<chunks.size();c++)
+      if(chunks[c] != 0) {
+	if(writable) MappedFile::flush(chunks[c],chunkBytes);
+	MappedFile::unmap(chunks[c],chunkBytes);
+      }
+    chunks.clear();
+    if(header != 0) {
+      if(writable) MappedFile::flush(header,MappedFile::ALIGNMENT);
+      MappedFile::unmap(header,MappedFile::ALIGNMENT);
+    }
+    header = 0;
+    file.close();
+  }
+
+  /// @return whether the archive is open
+  bool isOpen() const {
+    return header != 0;
+  }
+
+  /**
+   * append a record, can be called concurrently
+   *
+   * @param _x       parameter vector of size dimension
+   * @param _f       fitness
+   * @param _worker  id of the worker thread
+   * @param _step    algorithm step
+   * @return false if the archive could not grow
+   */
+  bool append(const double* _x,double _f,unsigned int _worker,unsigned long long _step) {
+    unsigned long long r = __sync_fetch_and_add(&header->count,1ULL);
+    char* c = chunk(r / chunkRecords);
+    if(c == 0) return false;
+    unsigned long i = r % chunkRecords;
+    double* x = (double*) c;
+    for(unsigned int j=0;j<dimension;j++) x[j*chunkRecords+i] = _x[j];
+    column<double>(c,0)[i] = _f;
+    column<double>(c,1)[i] = MappedFile::wallTime();
+    column<unsigned long long>(c,2)[i] = _step;
+    column<unsigned int>(c,3)[i] = _worker;
+    __sync_synchronize();
+    column<unsigned char>(c,4)[i] = 1;
+    return true;
+  }
+
+  /// @return number of reserved records (some may not be committed yet)
+  unsigned long long size() const {
+    return header == 0 ? 0 : header->count;
+  }
+
+  /// @return dimension of the parameter vectors
+  unsigned int getDimension() const {
+    return dimension;
+  }
+
+  /// @return whether record i is completely written, check before reading a record
+  bool committed(unsigned long long _i) {
+    const char* c = chunk(_i / chunkRecords);
+    return c != 0 && column<unsigned char>(c,4)[_i % chunkRecords] != 0;
+  }
+
+  /// @return j-th parameter of record i
+  double param(unsigned long long _i,unsigned int _j) {
+    return ((const double*) chunk(_i / chunkRecords))[_j*chunkRecords + _i % chunkRecords];
+  }
+
+  /// @return fitness of record i
+  double fitness(unsigned long long _i) {
+    return column<double>(chunk(_i / chunkRecords),0)[_i % chunkRecords];
+  }
+
+  /// @return wall clock time (seconds since 1970) of record i
+  double time(unsigned long long _i) {
+    return column<double>(chunk(_i / chunkRecords),1)[_i % chunkRecords];
+  }
+
+  /// @return algorithm step of record i
+  unsigned long long step(unsigned long long _i) {
+    return column<unsigned long long>(chunk(_i / chunkRecords),2)[_i % chunkRecords];
+  }
+
+  /// @return worker id of record i
+  unsigned int worker(unsigned long long _i) {
+    return column<unsigned int>(chunk(_i / chunkRecords),3)[_i % chunkRecords];
+  }
+
+  /**
+   * copy the parameter vector of record i
+   */
+  void getParams(unsigned long long _i,std::vector<double>& _x) {
+    _x.resize(dimension);
+    const double* x = (const double*) chunk(_i / chunkRecords);
+    unsigned long i = _i % chunkRecords;
+    for(unsigned int j=0;j<dimension;j++) _x[j] = x[j*chunkRecords+i];
+  }
+
+ private:
+
+  /// header block of the file
+  struct Header {
+    char                         magic[8];
+    unsigned int                 version;
+    unsigned int                 dimension;
+    unsigned int                 chunkRecords;
+    unsigned int                 reserved;
+    unsigned long long           chunkBytes;
+    volatile unsigned long long  count;
+  };
+
+  static const char* MAGIC() {
+    return "BBPEOARC";
+  }
+
+  /// size of a chunk rounded up to the mapping alignment
+  static unsigned long long bytesPerChunk(unsigned int _dimension,unsigned int _records) {
+    unsigned long long b = (unsigned long long) _records * (8ULL * (_dimension + 3) + 4 + 1);
+    return (b + MappedFile::ALIGNMENT - 1) / MappedFile::ALIGNMENT * MappedFile::ALIGNMENT;
+  }
+
+  bool readHeader() {
+    if(std::memcmp(header->magic,MAGIC(),8) != 0 || header->version != VERSION) return false;
+    dimension = header->dimension;
+    chunkRecords = header->chunkRecords;
+    chunkBytes = header->chunkBytes;
+    chunks.assign(MAX_CHUNKS,(char*) 0);
+    return true;
+  }
+
+  /// k-th column after the parameters: fitness, time, step, worker, committed
+  template<class T>
+  T* column(const char* _chunk,int _k) const {
+    unsigned long long offset = 8ULL * dimension * chunkRecords;
+    if(_k > 0) offset += 8ULL * chunkRecords * (_k < 3 ? _k : 3);
+    if(_k > 3) offset += 4ULL * chunkRecords;
+    return (T*) (_chunk + offset);
+  }
+
+  /**
+   * @return the mapped chunk, it is created by writers if necessary
+   */
+  char* chunk(unsigned long long _c) {
+    if(_c >= MAX_CHUNKS) return 0;
+    char* p = *((char* volatile*) &chunks[_c]);
+    if(p != 0) return p;
+#ifdef _OPENMP
+#pragma omp critical(EvalArchive)
+#endif
+    {
+      if(chunks[_c] == 0) {
+	unsigned long long offset = MappedFile::ALIGNMENT + _c * chunkBytes;
+	bool available = writable ? file.grow(offset + chunkBytes) : file.size() >= offset + chunkBytes;
+	char* q = available ? (char*) file.map(offset,chunkBytes) : 0;
+	__sync_synchronize();
+	chunks[_c] = q;
+      }
+      p = chunks[_c];
+    }
+    return p;
+  }
+
+  /// prevent copy cor
+  EvalArchive(const EvalArchive&);
+
+  /// prevent copy assignment
+  EvalArchive& operator=(const EvalArchive&);
+
+  MappedFile                file;          ///> mapped file
+  Header*                   header;        ///> mapped header block
+  bool                      writable;      ///> opened for appending
+  unsigned int              dimension;     ///> dimension of the parameter vectors
+  unsigned int              chunkRecords;  ///> records per chunk
+  unsigned long long        chunkBytes;    ///> bytes per chunk
+  std::vector<char*>        chunks;        ///> mapped chunks (0: not mapped)
+};
+
+#endif
@@ -0,0 +1,304 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _EvalCache_h
+#define _EvalCache_h
+
+#include <string>
+#include <cstring>
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define EVALCACHE_SLEEP() Sleep(1)
+#else
+#define EVALCACHE_SLEEP() usleep(1000)
+#endif
+
+/**
+ * \file EvalCache.h
+ * \class EvalCache
+ *
+ * Persistent cache of objective values in a memory mapped file, shared by
+ * runs, threads and processes. Entries are keyed by a hash of an identity
+ * string of the objective function and the exact bits of the parameter
+ * vector, the parameters are compared bitwise on lookup.
+ *
+ * The file is an open addressing hash table with a fixed number of slots
+ * (the size cap) chosen at creation. A key is searched within PROBES
+ * consecutive slots; if none is free the least recently used slot of this
+ * window is evicted. Slots are lock-free: a sequence number is odd while
+ * the slot is written (acquired by compare-and-swap), readers retry or skip
+ * a slot whose sequence number changed during reading. A slot of a process
+ * killed while writing stays locked and is not used anymore.
+ *
+ * @date: Oct. 2026
+ */
+class EvalCache {
+
+public:
+
+  /** file format version */
+  static const unsigned int VERSION = 1;
+
+  /** length of the probing window */
+  static const unsigned int PROBES = 16;
+
+  /// Cor.
+  EvalCache() : header(0),slots(0),dimension(0),capacity(0),slotBytes(0),objective(0) { }
+
+  /// Destructor
+  ~EvalCache() {
+    close();
+  }
+
+  /**
+   * open a cache, it is created if it does not exist
+   *
+   * @param _path       file name
+   * @param _dimension  dimension of the parameter vectors
+   * @param _capacity   number of slots of a new cache (ignored for existing caches)
+   * @param _identity   identity of the objective function (e.g. class name and model version)
+   * @return false on failure or if an existing cache has another dimension
+   */
+  bool open(const std::string& _path,unsigned int _dimension,unsigned long long _capacity,const std::string& _identity) {
+    close();
+    if(!file.open(_path,true) || !file.grow(MappedFile::ALIGNMENT)) return false;
+    header = (Header*) file.map(0,MappedFile::ALIGNMENT);
+    if(header == 0) return false;
+    // the first process initializes the header
+    if(__sync_bool_compare_and_swap(&header->state,0U,1U)) {
+      std::memcpy(header->magic,MAGIC(),8);
+      header->version = VERSION;
+      header->dimension = _dimension;
+      header->capacity = _capacity > PROBES ? _capacity : PROBES;
+      header->slotBytes = sizeof(Slot) + 8ULL * _dimension;
+      header->clock = 0;
+      header->used = 0;
+      bool ok = file.grow(MappedFile::ALIGNMENT + header->capacity * header->slotBytes);
+      __sync_synchronize();
+      header->state = ok ? 2 : 0;
+      if(!ok) {
+	close();
+	return false;
+      }
+    }
+    for(int i=0;header->state != 2 && i<10000;i++) EVALCACHE_SLEEP();
+    if(header->state != 2 || std::memcmp(header->magic,MAGIC(),8) != 0 ||
+       header->version != VERSION || header->dimension != _dimension) {
+      close();
+      return false;
+    }
+    dimension = header->dimension;
+    capacity = header->capacity;
+    slotBytes = header->slotBytes;
+    slots = (char*) file.map(MappedFile::ALIGNMENT,capacity * slotBytes);
+    if(slots == 0) {
+      close();
+      return false;
+    }
+    objective = hash(FNV_OFFSET(),_identity.data(),_identity.size());
+    return true;
+  }
+
+  /// flush and unmap
+  void close() {
+    if(slots != 0) {
+      MappedFile::flush(slots,capacity * slotBytes);
+      MappedFile::unmap(slots,capacity * slotBytes);
+    }
+    if(header != 0) {
+      MappedFile::flush(header,MappedFile::ALIGNMENT);
+      MappedFile::unmap(header,MappedFile::ALIGNMENT);
+    }
+    slots = 0;
+    header = 0;
+    file.close();
+  }
+
+  /// @return whether the cache is open
+  bool isOpen() const {
+    return slots != 0;
+  }
+
+  /**
+   * look up a parameter vector, can be called concurrently
+   *
+   * @param _x  parameter vector of size dimension
+   * @param _f  cached objective value (output)
+   * @return whether the vector is cached
+   */
+  bool lookup(const double* _x,double& _f) {
+    unsigned long long k = key(_x);
+    for(unsigned int p=0;p<PROBES;p++) {
+      Slot* s = slot(k,p);
+      unsigned long long seq = s->seq;
+      if(seq == 0) return false;      // never used, the key is not behind
+      if(seq & 1ULL) continue;        // being written
+      if(s->key != k || s->objective != objective) continue;
+      double f = s->fitness;
+      bool equal = std::memcmp(params(s),_x,8ULL * dimension) == 0;
+      __sync_synchronize();
+      if(s->seq != seq || !equal) continue;
+      s->stamp = __sync_add_and_fetch(&header->clock,1ULL);
+      _f = f;
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * insert an objective value, can be called concurrently. A cached 
+   * key is updated in place instead of occupying a second slot. 
+   *
+   * @param _x  parameter vector of size dimension
+   * @param _f  objective value
+   * @return false if no slot could be acquired
+   */
+  bool insert(const double* _x,double _f) {
+    unsigned long long k = key(_x);
+    for(int attempt=0;attempt<4;attempt++) {
+      // the slot of the key if it is cached, a free slot or else the
+      // least recently used one of the window
+      Slot* target = 0;
+      unsigned long long seq = 0;
+      for(unsigned int p=0;p<PROBES;p++) {
+	Slot* s = slot(k,p);
+	unsigned long long q = s->seq;
+	if(q & 1ULL) continue;
+	if(q != 0 && s->key == k && s->objective == objective &&
+	   std::memcmp(params(s),_x,8ULL * dimension) == 0) {
+	  target = s;
+	  seq = q;
+	  break;
+	}
+	if(q == 0 || target == 0 || s->stamp < target->stamp) {
+	  target = s;
+	  seq = q;
+	}
+	if(q == 0) break;
+      }
+      if(target == 0) return false;
+      if(!__sync_bool_compare_and_swap(&target->seq,seq,seq+1)) continue;
+      target->key = k;
+      target->objective = objective;
+      target->fitness = _f;
+      std::memcpy(params(target),_x,8ULL * dimension);
+      target->stamp = __sync_add_and_fetch(&header->clock,1ULL);
+      __sync_synchronize();
+      target->seq = seq + 2;
+      if(seq == 0) __sync_fetch_and_add(&header->used,1ULL);
+      return true;
+    }
+    return false;
+  }
+
+  /// @return number of used slots
+  unsigned long long size() const {
+    return header == 0 ? 0 : header->used;
+  }
+
+  /// @return number of slots
+  unsigned long long getCapacity() const {
+    return capacity;
+  }
+
+  /// @return dimension of the parameter vectors
+  unsigned int getDimension() const {
+    return dimension;
+  }
+
+ private:
+
+  /// header block of the file
+  struct Header {
+    char                         magic[8];
+    volatile unsigned int        state;      // 0: new, 1: initializing, 2: ready
+    unsigned int                 version;
+    unsigned int                 dimension;
+    unsigned int                 reserved;
+    unsigned long long           capacity;
+    unsigned long long           slotBytes;
+    volatile unsigned long long  clock;      // logical time of the last access
+    volatile unsigned long long  used;
+  };
+
+  /// slot, followed by the parameter vector
+  struct Slot {
+    volatile unsigned long long  seq;        // 0: never used, odd: being written
+    unsigned long long           key;
+    unsigned long long           objective;
+    volatile unsigned long long  stamp;      // logical time of the last access
+    double                       fitness;
+  };
+
+  static const char* MAGIC() {
+    return "BBPEOCCH";
+  }
+
+  static unsigned long long FNV_OFFSET() {
+    return 14695981039346656037ULL;
+  }
+
+  /// FNV-1a hash of a byte sequence
+  static unsigned long long hash(unsigned long long _h,const void* _data,unsigned long _length) {
+    const unsigned char* c = (const unsigned char*) _data;
+    for(unsigned long i=0;i<_length;i++) {
+      _h ^= c[i];
+      _h *= 1099511628211ULL;
+    }
+    return _h;
+  }
+
+  /// key of a parameter vector, mixed s.t. the low bits are well distributed
+  unsigned long long key(const double* _x) const {
+    unsigned long long h = hash(objective,_x,8ULL * dimension);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  Slot* slot(unsigned long long _key,unsigned int _probe) const {
+    return (Slot*) (slots + ((_key + _probe) % capacity) * slotBytes);
+  }
+
+  static double* params(Slot* _s) {
+    return (double*) (_s + 1);
+  }
+
+  /// prevent copy cor
+  EvalCache(const EvalCache&);
+
+  /// prevent copy assignment
+  EvalCache& operator=(const EvalCache&);
+
+  MappedFile          file;        ///> mapped file
+  Header*             header;      ///> mapped header block
+  char*               slots;       ///> mapped slots
+  unsigned int        dimension;   ///> dimension of the parameter vectors
+  unsigned long long  capacity;    ///> number of slots
+  unsigned long long  slotBytes;   ///> bytes per slot
+  unsigned long long  objective;   ///> hash of the objective identity
+};
+
+#undef EVALCACHE_SLEEP
+
+#endif
@@ -0,0 +1,660 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _Expression_h
+#define _Expression_h
+
+#include <map>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cctype>
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+/**
+ * \file Expression.h
+ * \class ExpressionProgram
+ *
+ * Register bytecode of an Expression compiled for a fixed dimension n.
+ * The register file holds the n variables, the constants and the
+ * temporaries. Each instruction combines two registers into a third one.
+ * A single point run reads the variables in place, its workspace holds the
+ * constants and the temporaries only (evaluate() reads the constants in
+ * place, too).
+ *
+ * The interpreter is templated on the scalar type (double or Dual<N> for
+ * automatic differentiation). The batch interpreter runs each instruction
+ * over BATCH candidates at once (one register row per candidate lane), s.t.
+ * the dispatch is amortized and the inner loops are vectorized.
+ *
+ * @date: Oct. 2026
+ */
+class ExpressionProgram {
+
+public:
+
+  /** number of candidates of a batch */
+  static const unsigned int BATCH = 32;
+
+  /// opcodes (POWC: a^b with b a constant register)
+  enum Op { ADD, SUB, MUL, DIV, NEG, POW, SQRT, EXP, LOG, SIN, COS, TAN, ATAN, TANH, ABS, MIN, MAX, POWC };
+
+  /// instruction dst = a op b
+  struct Instruction {
+    int op, dst, a, b;
+  };
+
+  /// Cor.
+  ExpressionProgram() : dim(0),numRegisters(0),result(0) { }
+
+  /// @return dimension of the variables
+  unsigned int dimension() const {
+    return dim;
+  }
+
+  /// @return number of registers
+  unsigned int registers() const {
+    return numRegisters;
+  }
+
+  /// @return number of instructions
+  unsigned int size() const {
+    return code.size();
+  }
+
+  /// @return number of registers of a single point run, the variables are read in place
+  unsigned int workspace() const {
+    return numRegisters - dim;
+  }
+
+  /// @return number of temporaries, registers dim + num. of constants ...
+  unsigned int temporaries() const {
+    return numRegisters - dim - constants.size();
+  }
+
+  /**
+   * evaluate the program for a single point
+   *
+   * @param _x  variables x[0] ... x[n-1]
+   * @param _W  registers dim ... of workspace() scalars (constants and temporaries)
+   * @return value of the expression
+   */
+  template<class Scalar>
+  Scalar run(const Scalar* _x,Scalar* _W) const {
+    for(unsigned c=0;c<constants.size();c++) _W[c] = constants[c];
+    return exec(_x,_W,_W + constants.size());
+  }
+
+  /**
+   * evaluate the program for a single point, variables and constants are
+   * read in place
+   *
+   * @param _x  variables x[0] ... x[n-1]
+   * @param _T  temporaries() doubles
+   * @return value of the expression
+   */
+  double evaluate(const double* _x,double* _T) const {
+    return exec(_x,constants.empty() ? 0 : &constants[0],_T);
+  }
+
+  /**
+   * evaluate the program for a batch of points
+   *
+   * @param _x      pointers to the variables of the points
+   * @param _count  number of points
+   * @param _out    values of the expression
+   * @param _R      register file of registers() * BATCH doubles
+   */
+  void run(const double* const* _x,unsigned int _count,double* _out,double* _R) const {
+    for(unsigned c=0;c<constants.size();c++)
+      for(unsigned l=0;l<BATCH;l++) _R[(dim+c)*BATCH+l] = constants[c];
+    for(unsigned p0=0;p0<_count;p0+=BATCH) {
+      unsigned m = std::min(BATCH,_count - p0);
+      for(unsigned l=0;l<m;l++) {
+	const double* x = _x[p0+l];
+	for(unsigned i=0;i<dim;i++) _R[i*BATCH+l] = x[i];
+      }
+      for(unsigned k=0;k<code.size();k++) {
+	const Instruction& in = code[k];
+	const double* a = _R + in.a * BATCH;
+	const double* b = _R + in.b * BATCH;
+	double* r = _R + in.dst * BATCH;
+	switch(in.op) {
+	case ADD:  for(unsigned l=0;l<m;l++) r[l] = a[l] + b[l]; break;
+	case SUB:  for(unsigned l=0;l<m;l++) r[l] = a[l] - b[l]; break;
+	case MUL:  for(unsigned l=0;l<m;l++) r[l] = a[l] * b[l]; break;
+	case DIV:  for(unsigned l=0;l<m;l++) r[l] = a[l] / b[l]; break;
+	case NEG:  for(unsigned l=0;l<m;l++) r[l] = -a[l]; break;
+	case POW:  for(unsigned l=0;l<m;l++) r[l] = std::pow(a[l],b[l]); break;
+	case SQRT: for(unsigned l=0;l<m;l++) r[l] = std::sqrt(a[l]); break;
+	case EXP:  for(unsigned l=0;l<m;l++) r[l] = std::exp(a[l]); break;
+	case LOG:  for(unsigned l=0;l<m;l++) r[l] = std::log(a[l]); break;
+	case SIN:  for(unsigned l=0;l<m;l++) r[l] = std::sin(a[l]); break;
+	case COS:  for(unsigned l=0;l<m;l++) r[l] = std::cos(a[l]); break;
+	case TAN:  for(unsigned l=0;l<m;l++) r[l] = std::tan(a[l]); break;
+	case ATAN: for(unsigned l=0;l<m;l++) r[l] = std::atan(a[l]); break;
+	case TANH: for(unsigned l=0;l<m;l++) r[l] = std::tanh(a[l]); break;
+	case ABS:  for(unsigned l=0;l<m;l++) r[l] = std::fabs(a[l]); break;
+	case MIN:  for(unsigned l=0;l<m;l++) r[l] = b[l] < a[l] ? b[l] : a[l]; break;
+	case MAX:  for(unsigned l=0;l<m;l++) r[l] = a[l] < b[l] ? b[l] : a[l]; break;
+	case POWC: {
+	  double p = constants[in.b - dim];
+	  for(unsigned l=0;l<m;l++) r[l] = std::pow(a[l],p);
+	  break;
+	}
+	}
+      }
+      for(unsigned l=0;l<m;l++) _out[p0+l] = _R[result*BATCH+l];
+    }
+  }
+
+  /**
+   * apply an operation to constants (constant folding)
+   */
+  static double apply(int _op,double _a,double _b) {
+    double R[3] = { _a, _b, 0.0 };
+    ExpressionProgram p;
+    Instruction in = { _op, 2, 0, 1 };
+    p.code.push_back(in);
+    p.numRegisters = 3;
+    p.result = 2;
+    return p.run<double>(R,R);
+  }
+
+ private:
+
+  friend class Expression;
+
+  /// interpreter with the variables _x, the constants _C and the temporaries _T
+  template<class Scalar>
+  Scalar exec(const Scalar* _x,const Scalar* _C,Scalar* _T) const {
+    using std::pow; using std::sqrt; using std::exp; using std::log; using std::sin;
+    using std::cos; using std::tan; using std::atan; using std::tanh; using std::fabs;
+    const int d = dim, t = dim + constants.size();
+    for(unsigned k=0;k<code.size();k++) {
+      const Instruction& in = code[k];
+      const Scalar& a = in.a < d ? _x[in.a] : (in.a < t ? _C[in.a - d] : _T[in.a - t]);
+      const Scalar& b = in.b < d ? _x[in.b] : (in.b < t ? _C[in.b - d] : _T[in.b - t]);
+      Scalar& r = _T[in.dst - t];
+      switch(in.op) {
+      case ADD:  r = a + b; break;
+      case SUB:  r = a - b; break;
+      case MUL:  r = a * b; break;
+      case DIV:  r = a / b; break;
+      case NEG:  r = -a; break;
+      case POW:  r = pow(a,b); break;
+      case SQRT: r = sqrt(a); break;
+      case EXP:  r = exp(a); break;
+      case LOG:  r = log(a); break;
+      case SIN:  r = sin(a); break;
+      case COS:  r = cos(a); break;
+      case TAN:  r = tan(a); break;
+      case ATAN: r = atan(a); break;
+      case TANH: r = tanh(a); break;
+      case ABS:  r = fabs(a); break;
+      case MIN:  r = (b < a) ? b : a; break;
+      case MAX:  r = (a < b) ? b : a; break;
+      case POWC: r = pow(a,constants[in.b - d]); break;
+      }
+    }
+    return result < d ? _x[result] : (result < t ? _C[result - d] : _T[result - t]);
+  }
+
+  unsigned int               dim;           ///> dimension
+  unsigned int               numRegisters;  ///> size of the register file
+  int                        result;        ///> register of the result
+  std::vector<double>        constants;     ///> constants, registers dim ...
+  std::vector<Instruction>   code;          ///> instructions
+};
+
+
+/**
+ * \class Expression
+ *
+ * Formula over the variables x[0] ... x[n-1], parsed once and compiled into
+ * an ExpressionProgram for each dimension n. Grammar:
+ *
+ *   expr    := term (('+'|'-') term)*
+ *   term    := unary (('*'|'/') unary)*
+ *   unary   := ('-'|'+') unary | power
+ *   power   := primary ('^' unary)?
+ *   primary := number | 'n' | 'pi' | index | 'x[' expr ']' | '(' expr ')'
+ *            | f '(' expr ')'      f = sqrt exp log sin cos tan atan tanh abs
+ *            | g '(' expr ',' expr ')'     g = pow min max
+ *            | ('sum'|'prod') '(' index ',' expr ',' expr ',' expr ')'
+ *
+ * n is the dimension, sum(i,a,b,f) (prod) is the sum (product) of f over the
+ * integers i = a ... b. Indices of x, bounds and indices are constant once n
+ * is known: the sums are unrolled and all constant subexpressions are
+ * folded, x[i+1] becomes a register. E.g. Rosenbrock:
+ *
+ *   sum(i,0,n-2,100*(x[i+1]-x[i]^2)^2+(x[i]-1)^2)
+ *
+ * @date: Oct. 2026
+ */
+class Expression {
+
+public:
+
+  /// Cor.
+  Expression() : root(-1),numIndices(0) { }
+
+  /**
+   * parse a formula
+   *
+   * @param _formula formula
+   * @return false on syntax errors, @see error()
+   */
+  bool parse(const std::string& _formula) {
+    text = _formula;
+    pos = 0;
+    nodes.clear();
+    indices.clear();
+    numIndices = 0;
+    message.clear();
+    root = parseExpr();
+    skipSpace();
+    if(root >= 0 && pos < text.size()) fail("unexpected character");
+    if(!message.empty()) root = -1;
+    return root >= 0;
+  }
+
+  /// @return whether a formula is parsed
+  bool isValid() const {
+    return root >= 0;
+  }
+
+  /// @return the formula
+  const std::string& formula() const {
+    return text;
+  }
+
+  /// @return the last error message
+  const std::string& error() const {
+    return message;
+  }
+
+  /**
+   * compile the formula for the dimension _n
+   *
+   * @param _n     dimension
+   * @param _prog  compiled program
+   * @return false if an index of x is out of range or a bound is not constant, @see error()
+   */
+  bool compile(unsigned int _n,ExpressionProgram& _prog) {
+    message.clear();
+    if(root < 0) {
+      message = "no formula";
+      return false;
+    }
+    prog = ExpressionProgram();
+    prog.dim = _n;
+    constIds.clear();
+    freeTemps.clear();
+    numTemps = 0;
+    env.assign(numIndices,0.0);
+    Operand r = emit(root);
+    if(!message.empty()) return false;
+    if(r.kind == TEMP) freeTemps.push_back(r.id);
+    // relocation: variables, constants, temporaries
+    int base = _n + prog.constants.size();
+    for(unsigned k=0;k<prog.code.size();k++) {
+      ExpressionProgram::Instruction& in = prog.code[k];
+      in.dst = reloc(in.dst,base);
+      in.a = reloc(in.a,base);
+      in.b = reloc(in.b,base);
+    }
+    prog.result = reloc(encode(r),base);
+    prog.numRegisters = base + numTemps;
+    _prog = prog;
+    return true;
+  }
+
+ private:
+
+  /// node kinds
+  enum Kind { NUM, DIM, INDEX, VAR, UNARY, BINARY, SUM, PROD };
+
+  /// node of the syntax tree
+  struct Node {
+    int kind, op, a, b, c, d;
+    double value;
+  };
+
+  /// operand kinds of the code generation
+  enum OperandKind { CONST, XVAR, TEMP };
+
+  /// operand: constant value, variable or temporary register
+  struct Operand {
+    int kind, id;
+    double value;
+  };
+
+  // ---------------------------------------------------------------- parser
+
+  void fail(const std::string& _what) {
+    if(!message.empty()) return;
+    std::ostringstream os;
+    os << _what << " at position " << pos << " of \"" << text << "\"";
+    message = os.str();
+  }
+
+  void skipSpace() {
+    while(pos < text.size() && std::isspace((unsigned char) text[pos])) pos++;
+  }
+
+  bool accept(char _c) {
+    skipSpace();
+    if(pos < text.size() && text[pos] == _c) {
+      pos++;
+      return true;
+    }
+    return false;
+  }
+
+  void expect(char _c) {
+    if(!accept(_c)) fail(std::string("expected '") + _c + "'");
+  }
+
+  std::string identifier() {
+    skipSpace();
+    size_t p = pos;
+    while(pos < text.size() && (std::isalnum((unsigned char) text[pos]) || text[pos] == '_')) pos++;
+    return text.substr(p,pos-p);
+  }
+
+  int node(int _kind,int _op=0,int _a=-1,int _b=-1,double _value=0.0) {
+    Node nd = { _kind, _op, _a, _b, -1, -1, _value };
+    nodes.push_back(nd);
+    return nodes.size() - 1;
+  }
+
+  int parseExpr() {
+    int l = parseTerm();
+    while(message.empty()) {
+      if(accept('+')) l = node(BINARY,ExpressionProgram::ADD,l,parseTerm());
+      else if(accept('-')) l = node(BINARY,ExpressionProgram::SUB,l,parseTerm());
+      else break;
+    }
+    return l;
+  }
+
+  int parseTerm() {
+    int l = parseUnary();
+    while(message.empty()) {
+      if(accept('*')) l = node(BINARY,ExpressionProgram::MUL,l,parseUnary());
+      else if(accept('/')) l = node(BINARY,ExpressionProgram::DIV,l,parseUnary());
+      else break;
+    }
+    return l;
+  }
+
+  int parseUnary() {
+    if(accept('-')) return node(UNARY,ExpressionProgram::NEG,parseUnary());
+    if(accept('+')) return parseUnary();
+    int l = parsePrimary();
+    if(accept('^')) return node(BINARY,ExpressionProgram::POW,l,parseUnary());
+    return l;
+  }
+
+  int parsePrimary() {
+    skipSpace();
+    if(!message.empty() || pos >= text.size()) {
+      fail("unexpected end");
+      return -1;
+    }
+    char c = text[pos];
+    if(std::isdigit((unsigned char) c) || c == '.') {
+      char* end;
+      double v = std::strtod(text.c_str() + pos,&end);
+      pos = end - text.c_str();
+      return node(NUM,0,-1,-1,v);
+    }
+    if(accept('(')) {
+      int e = parseExpr();
+      expect(')');
+      return e;
+    }
+    std::string id = identifier();
+    if(id.empty()) {
+      fail("unexpected character");
+      return -1;
+    }
+    if(id == "x") {
+      expect('[');
+      int e = parseExpr();
+      expect(']');
+      return node(VAR,0,e);
+    }
+    if(id == "n") return node(DIM);
+    if(id == "pi") return node(NUM,0,-1,-1,M_PI);
+    std::map<std::string,int>::iterator it = indices.find(id);
+    if(it != indices.end() && it->second >= 0) return node(INDEX,it->second);
+    int op = function(id);
+    if(op >= 0) {
+      expect('(');
+      int a = parseExpr(), b = -1;
+      if(op == ExpressionProgram::POW || op == ExpressionProgram::MIN || op == ExpressionProgram::MAX) {
+	expect(',');
+	b = parseExpr();
+      }
+      expect(')');
+      return node(b < 0 ? UNARY : BINARY,op,a,b);
+    }
+    if(id == "sum" || id == "prod") {
+      expect('(');
+      std::string var = identifier();
+      if(var.empty() || var == "x" || var == "n") fail("expected an index name");
+      expect(',');
+      int lo = parseExpr();
+      expect(',');
+      int hi = parseExpr();
+      expect(',');
+      // the index is visible in the summand only
+      int slot = numIndices++;
+      std::map<std::string,int>::iterator old = indices.find(var);
+      int saved = old == indices.end() ? -1 : old->second;
+      indices[var] = slot;
+      int body = parseExpr();
+      indices[var] = saved;
+      expect(')');
+      int s = node(id == "sum" ? SUM : PROD,slot,lo,hi);
+      nodes[s].c = body;
+      return s;
+    }
+    fail("unknown identifier " + id);
+    return -1;
+  }
+
+  static int function(const std::string& _id) {
+    const char* names[] = { "sqrt","exp","log","sin","cos","tan","atan","tanh","abs","pow","min","max" };
+    const int ops[] = { ExpressionProgram::SQRT, ExpressionProgram::EXP, ExpressionProgram::LOG,
+			ExpressionProgram::SIN, ExpressionProgram::COS, ExpressionProgram::TAN,
+			ExpressionProgram::ATAN, ExpressionProgram::TANH, ExpressionProgram::ABS,
+			ExpressionProgram::POW, ExpressionProgram::MIN, ExpressionProgram::MAX };
+    for(int k=0;k<12;k++)
+      if(_id == names[k]) return ops[k];
+    return -1;
+  }
+
+  // ------------------------------------------------------- code generation
+
+  static Operand constant(double _v) {
+    Operand o = { CONST, 0, _v };
+    return o;
+  }
+
+  /// operand as a register id before relocation (variables >= 0, constants -1, -2 ..., temporaries below -2^29)
+  int encode(const Operand& _o) {
+    if(_o.kind == XVAR) return _o.id;
+    if(_o.kind == TEMP) return -(1 << 30) + _o.id;
+    std::map<double,int>::iterator it = constIds.find(_o.value);
+    if(it != constIds.end()) return -1 - it->second;
+    prog.constants.push_back(_o.value);
+    constIds[_o.value] = prog.constants.size() - 1;
+    return -(int) prog.constants.size();
+  }
+
+  int reloc(int _id,int _base) {
+    if(_id >= 0) return _id;
+    if(_id < -(1 << 29)) return _base + (_id + (1 << 30));
+    return prog.dim + (-1 - _id);
+  }
+
+  void release(const Operand& _o) {
+    if(_o.kind == TEMP) freeTemps.push_back(_o.id);
+  }
+
+  /**
+   * append an instruction, the temporaries of the operands are reused unless _keep
+   */
+  Operand instruction(int _op,const Operand& _a,const Operand& _b,bool _keep=false) {
+    int a = encode(_a), b = encode(_b);
+    if(!_keep) {
+      release(_a);
+      if(b != a) release(_b);
+    }
+    Operand r = { TEMP, 0, 0.0 };
+    if(freeTemps.empty())
+      r.id = numTemps++;
+    else {
+      r.id = freeTemps.back();
+      freeTemps.pop_back();
+    }
+    ExpressionProgram::Instruction in = { _op, encode(r), a, b };
+    prog.code.push_back(in);
+    return r;
+  }
+
+  /// constant folding, simplification and instruction selection
+  Operand combine(int _op,const Operand& _a,const Operand& _b) {
+    bool ca = _a.kind == CONST, cb = _b.kind == CONST;
+    bool unary = _op != ExpressionProgram::ADD && _op != ExpressionProgram::SUB && _op != ExpressionProgram::MUL &&
+      _op != ExpressionProgram::DIV && _op != ExpressionProgram::POW && _op != ExpressionProgram::MIN && _op != ExpressionProgram::MAX;
+    if(ca && (unary || cb)) return constant(ExpressionProgram::apply(_op,_a.value,_b.value));
+    switch(_op) {
+    case ExpressionProgram::ADD:
+      if(ca && _a.value == 0.0) return _b;
+      if(cb && _b.value == 0.0) return _a;
+      break;
+    case ExpressionProgram::SUB:
+      if(cb && _b.value == 0.0) return _a;
+      if(ca && _a.value == 0.0) return combine(ExpressionProgram::NEG,_b,_b);
+      break;
+    case ExpressionProgram::MUL:
+      if(ca && _a.value == 1.0) return _b;
+      if(cb && _b.value == 1.0) return _a;
+      break;
+    case ExpressionProgram::DIV:
+      if(cb && _b.value == 1.0) return _a;
+      if(cb && _b.value != 0.0) return combine(ExpressionProgram::MUL,_a,constant(1.0 / _b.value));
+      break;
+    case ExpressionProgram::POW:
+      if(cb && _b.value == 1.0) return _a;
+      if(cb && _b.value == 0.5) return combine(ExpressionProgram::SQRT,_a,_a);
+      // small integer powers by multiplications
+      if(cb && _b.value == 2.0) return instruction(ExpressionProgram::MUL,_a,_a);
+      if(cb && _b.value == 3.0) {
+	Operand sq = instruction(ExpressionProgram::MUL,_a,_a,true);
+	return instruction(ExpressionProgram::MUL,sq,_a);
+      }
+      // constant exponent, no tangents of the exponent (defined for a < 0)
+      if(cb) return instruction(ExpressionProgram::POWC,_a,_b);
+      break;
+    }
+    return instruction(_op,_a,unary ? _a : _b);
+  }
+
+  Operand emit(int _node) {
+    if(!message.empty() || _node < 0) return constant(0.0);
+    const Node& nd = nodes[_node];
+    switch(nd.kind) {
+    case NUM:
+      return constant(nd.value);
+    case DIM:
+      return constant(prog.dim);
+    case INDEX:
+      return constant(env[nd.op]);
+    case VAR: {
+      Operand i = emit(nd.a);
+      if(i.kind != CONST) {
+	message = "index of x is not constant in \"" + text + "\"";
+	release(i);
+	return constant(0.0);
+      }
+      long k = (long) std::floor(i.value + 0.5);
+      if(k < 0 || k >= (long) prog.dim) {
+	std::ostringstream os;
+	os << "x[" << k << "] out of range for n = " << prog.dim << " in \"" << text << "\"";
+	message = os.str();
+	return constant(0.0);
+      }
+      Operand o = { XVAR, (int) k, 0.0 };
+      return o;
+    }
+    case UNARY: {
+      Operand a = emit(nd.a);
+      return combine(nd.op,a,a);
+    }
+    case BINARY: {
+      Operand a = emit(nd.a);
+      Operand b = emit(nd.b);
+      return combine(nd.op,a,b);
+    }
+    case SUM:
+    case PROD: {
+      Operand lo = emit(nd.a), hi = emit(nd.b);
+      if(lo.kind != CONST || hi.kind != CONST) {
+	message = "bounds of sum / prod are not constant in \"" + text + "\"";
+	return constant(0.0);
+      }
+      int op = nd.kind == SUM ? ExpressionProgram::ADD : ExpressionProgram::MUL;
+      Operand acc = constant(nd.kind == SUM ? 0.0 : 1.0);
+      double saved = env[nd.op];
+      for(long i=(long) std::floor(lo.value + 0.5);i<=(long) std::floor(hi.value + 0.5) && message.empty();i++) {
+	env[nd.op] = i;
+	Operand t = emit(nd.c);
+	acc = combine(op,acc,t);
+      }
+      env[nd.op] = saved;
+      return acc;
+    }
+    }
+    return constant(0.0);
+  }
+
+  std::string                 text;       ///> formula
+  size_t                      pos;        ///> parser position
+  std::vector<Node>           nodes;      ///> syntax tree
+  int                         root;       ///> root node (-1: none)
+  std::map<std::string,int>   indices;    ///> visible indices of sum / prod (-1: hidden)
+  int                         numIndices; ///> number of indices
+  std::string                 message;    ///> last error
+
+  ExpressionProgram           prog;       ///> program under construction
+  std::map<double,int>        constIds;   ///> constants of the program
+  std::vector<int>            freeTemps;  ///> free temporaries
+  int                         numTemps;   ///> number of temporaries
+  std::vector<double>         env;        ///> values of the indices
+};
+
+#endif
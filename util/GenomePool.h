@@ -0,0 +1,151 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _GenomePool_h
+#define _GenomePool_h
+
+#include <vector>
+#include <algorithm>
+
+/**
+ * \file GenomePool.h
+ * \class GenomePool
+ *
+ * Pool of genome buffers recycled from generation to generation. The
+ * genomes of EORVT are std::vector<double> with the default allocator,
+ * hence buffers are not allocated from the pool but handed over by
+ * swapping: release() takes the buffer of a discarded individual, acquire()
+ * gives it to a new one, s.t. a copy into the individual reuses the buffer
+ * instead of calling malloc.
+ *
+ * The pool serves the generation loop of the evolutionary algorithms
+ * (PopulationSearchManagerEA) and is not thread-safe, it is used by the
+ * serial selection and replacement steps of a generation. The local
+ * searches do not use it: their neighbors and evaluation points are
+ * members reused from iteration to iteration, s.t. they do not allocate
+ * after the first iteration (see examples/11allocation).
+ *
+ * @date: Oct. 2026
+ */
+class GenomePool {
+
+public:
+
+  /**
+   * Cor.
+   */
+  GenomePool() : numFree(0),held(0),highWater(0),numAcquired(0),numRecycled(0) { }
+
+  /**
+   * give a recycled buffer to a genome, the buffer is only exchanged if
+   * the capacity of the genome is too small
+   *
+   * @param _genome  genome (usually empty)
+   * @param _size    size of the genome
+   */
+  void acquire(std::vector<double>& _genome,unsigned int _size) {
+    numAcquired++;
+    if(_genome.capacity() < _size && numFree > 0) {
+      std::vector<double>& b = free[--numFree];
+      held -= b.capacity();
+      _genome.swap(b);
+      // free slots stay empty
+      std::vector<double>().swap(b);
+      numRecycled++;
+    }
+    _genome.resize(_size);
+  }
+
+  /**
+   * take over the buffer of a discarded genome, the genome is empty afterwards
+   */
+  void release(std::vector<double>& _genome) {
+    if(_genome.capacity() == 0) return;
+    if(numFree == free.size()) grow();
+    std::vector<double>& b = free[numFree++];
+    b.swap(_genome);
+    held += b.capacity();
+    highWater = std::max(highWater,held);
+  }
+
+  /**
+   * take over the buffers of the individuals _from,...,end of a population
+   */
+  template<class Pop>
+  void releaseAll(Pop& _pop,unsigned int _from=0) {
+    for(unsigned int i=_from;i<_pop.size();i++) release(_pop[i]);
+  }
+
+  /// @return num. of acquired genomes
+  unsigned long getNumAcquired() const {
+    return numAcquired;
+  }
+
+  /// @return num. of acquired genomes which got a recycled buffer
+  unsigned long getNumRecycled() const {
+    return numRecycled;
+  }
+
+  /// @return num. of doubles held by the free list
+  unsigned long getSize() const {
+    return held;
+  }
+
+  /// @return high-water mark of the free list in bytes
+  unsigned long getHighWaterMark() const {
+    return highWater * sizeof(double);
+  }
+
+  /**
+   * free all recycled buffers
+   */
+  void clear() {
+    std::vector<std::vector<double> >().swap(free);
+    numFree = 0;
+    held = 0;
+  }
+
+protected:
+
+  /// double the slots of the free list, the buffers are moved by swapping
+  void grow() {
+    std::vector<std::vector<double> > larger(std::max<size_t>(16,2 * free.size()));
+    for(unsigned int i=0;i<numFree;i++) larger[i].swap(free[i]);
+    free.swap(larger);
+  }
+
+  std::vector<std::vector<double> > free;  ///> buffers 0,...,numFree-1, further slots are empty
+  unsigned int  numFree;      ///> num. of free buffers
+  unsigned long held;         ///> num. of doubles of the free buffers
+  unsigned long highWater;    ///> max. of held
+  unsigned long numAcquired;  ///> num. of acquired genomes
+  unsigned long numRecycled;  ///> num. of recycled buffers
+
+private:
+
+  /// prevent copy cor
+  GenomePool(const GenomePool&);
+
+  /// prevent copy assignment
+  GenomePool& operator=(const GenomePool&);
+
+};
+
+#endif
@@ -0,0 +1,492 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _LinearAlgebra_h
+#define _LinearAlgebra_h
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+/**
+ * \file LinearAlgebra.h
+ * \class LinearAlgebra
+ *
+ * A collection of dense linear algebra kernels on row-major matrices
+ * stored as contiguous std::vector<double>. The matrix kernels are cache
+ * blocked with contiguous inner loops, s.t. the compiler can vectorize
+ * them (-O3), no BLAS / LAPACK is required.
+ *
+ * @date: Oct. 2026
+ */
+class LinearAlgebra {
+
+public:
+
+  /** block size of the cache blocked kernels */
+  static const int BLOCK = 64;
+
+  /**
+   * C = A * B^T
+   *
+   * @param _A  m x k matrix
+   * @param _B  n x k matrix
+   * @param _C  m x n result matrix
+   */
+  static void multABt(const double* _A,const double* _B,double* _C,int _m,int _n,int _k) {
+    for(int i=0;i<_m*_n;i++) _C[i] = 0.0;
+    for(int i0=0;i0<_m;i0+=BLOCK) {
+      int i1 = std::min(i0+BLOCK,_m);
+      for(int j0=0;j0<_n;j0+=BLOCK) {
+	int j1 = std::min(j0+BLOCK,_n);
+	for(int l0=0;l0<_k;l0+=BLOCK) {
+	  int l1 = std::min(l0+BLOCK,_k);
+	  for(int i=i0;i<i1;i++) {
+	    const double* a = _A + i*_k;
+	    for(int j=j0;j<j1;j++) {
+	      const double* b = _B + j*_k;
+	      double s = 0.0;
+	      for(int l=l0;l<l1;l++) s += a[l] * b[l];
+	      _C[i*_n+j] += s;
+	    }
+	  }
+	}
+      }
+    }
+  }
+
+  /**
+   * symmetric rank-k update C += alpha * Y^T * Y
+   *
+   * @param _alpha  scaling factor
+   * @param _Y      m x n matrix
+   * @param _C      n x n symmetric matrix
+   */
+  static void rankUpdate(double _alpha,const double* _Y,int _m,int _n,double* _C) {
+    for(int i0=0;i0<_n;i0+=BLOCK) {
+      int i1 = std::min(i0+BLOCK,_n);
+      for(int j0=i0;j0<_n;j0+=BLOCK) {
+	int j1 = std::min(j0+BLOCK,_n);
+	for(int k=0;k<_m;k++) {
+	  const double* y = _Y + k*_n;
+	  for(int i=i0;i<i1;i++) {
+	    double a = _alpha * y[i];
+	    double* c = _C + i*_n;
+	    for(int j=std::max(j0,i);j<j1;j++)
+	      c[j] += a * y[j];
+	  }
+	}
+      }
+    }
+    // mirror the upper triangle
+    for(int i=0;i<_n;i++)
+      for(int j=i+1;j<_n;j++)
+	_C[j*_n+i] = _C[i*_n+j];
+  }
+
+  /**
+   * y = A * x
+   *
+   * @param _A  m x n matrix
+   * @param _x  vector of size n
+   * @param _y  vector of size m
+   */
+  static void multAx(const double* _A,const double* _x,double* _y,int _m,int _n) {
+    for(int i=0;i<_m;i++) {
+      const double* a = _A + i*_n;
+      double s = 0.0;
+      for(int j=0;j<_n;j++) s += a[j] * _x[j];
+      _y[i] = s;
+    }
+  }
+
+  /**
+   * y = A^T * x
+   *
+   * @param _A  m x n matrix
+   * @param _x  vector of size m
+   * @param _y  vector of size n
+   */
+  static void multAtx(const double* _A,const double* _x,double* _y,int _m,int _n) {
+    for(int j=0;j<_n;j++) _y[j] = 0.0;
+    for(int i=0;i<_m;i++) {
+      const double* a = _A + i*_n;
+      double xi = _x[i];
+      for(int j=0;j<_n;j++) _y[j] += a[j] * xi;
+    }
+  }
+
+  /**
+   * dot product
+   */
+  static double dot(const double* _x,const double* _y,int _n) {
+    double s = 0.0;
+    for(int i=0;i<_n;i++) s += _x[i] * _y[i];
+    return s;
+  }
+
+  /**
+   * sum of squared differences sum_i (x_i - y_i)^2, four independent
+   * partial sums s.t. the compiler can vectorize the reduction
+   */
+  static double sumSquaredDiff(const double* _x,const double* _y,long _n) {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    long i = 0;
+    for(;i+4<=_n;i+=4) {
+      double d0 = _x[i] - _y[i], d1 = _x[i+1] - _y[i+1];
+      double d2 = _x[i+2] - _y[i+2], d3 = _x[i+3] - _y[i+3];
+      s0 += d0 * d0;
+      s1 += d1 * d1;
+      s2 += d2 * d2;
+      s3 += d3 * d3;
+    }
+    for(;i<_n;i++) s0 += (_x[i] - _y[i]) * (_x[i] - _y[i]);
+    return (s0 + s1) + (s2 + s3);
+  }
+
+  /**
+   * weighted sum of squared differences sum_i w_i (x_i - y_i)^2
+   */
+  static double sumSquaredDiff(const double* _x,const double* _y,const double* _w,long _n) {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    long i = 0;
+    for(;i+4<=_n;i+=4) {
+      double d0 = _x[i] - _y[i], d1 = _x[i+1] - _y[i+1];
+      double d2 = _x[i+2] - _y[i+2], d3 = _x[i+3] - _y[i+3];
+      s0 += _w[i] * d0 * d0;
+      s1 += _w[i+1] * d1 * d1;
+      s2 += _w[i+2] * d2 * d2;
+      s3 += _w[i+3] * d3 * d3;
+    }
+    for(;i<_n;i++) s0 += _w[i] * (_x[i] - _y[i]) * (_x[i] - _y[i]);
+    return (s0 + s1) + (s2 + s3);
+  }
+
+  /**
+   * Eigen decomposition of a symmetric matrix via Householder
+   * tridiagonalization and the QL algorithm (tred2 / tql2, JAMA)
+   *
+   * @param _n  dimension
+   * @param _V  on input the symmetric matrix, on output the eigenvectors as columns
+   * @param _d  eigenvalues
+   */
+  static void symmetricEigen(int _n,std::vector<double>& _V,std::vector<double>& _d) {
+    std::vector<double> e(_n,0.0);
+    _d.resize(_n);
+    tred2(_n,&_V[0],&_d[0],&e[0]);
+    tql2(_n,&_V[0],&_d[0],&e[0]);
+  }
+
+  /**
+   * in-place Cholesky factorization A = L * L^T of a symmetric positive
+   * definite matrix, the lower triangle of A is overwritten by L
+   *
+   * @param _n  dimension
+   * @param _A  n x n matrix
+   * @return false if the matrix is not positive definite
+   */
+  static bool cholesky(int _n,double* _A) {
+    for(int j=0;j<_n;j++) {
+      double* aj = _A + j*_n;
+      double s = aj[j] - dot(aj,aj,j);
+      if(s <= 0.0) return false;
+      double ljj = std::sqrt(s);
+      aj[j] = ljj;
+      for(int i=j+1;i<_n;i++) {
+	double* ai = _A + i*_n;
+	ai[j] = (ai[j] - dot(ai,aj,j)) / ljj;
+      }
+      for(int i=j+1;i<_n;i++) aj[i] = 0.0;
+    }
+    return true;
+  }
+
+  /**
+   * solve L * L^T x = b for a Cholesky factor L
+   *
+   * @param _n  dimension
+   * @param _L  n x n lower triangular factor
+   * @param _b  on input right hand side, on output the solution
+   */
+  static void choleskySolve(int _n,const double* _L,double* _b) {
+    forwardSubst(_n,_L,_b);
+    for(int i=_n-1;i>=0;i--) {
+      double s = _b[i];
+      for(int k=i+1;k<_n;k++) s -= _L[k*_n+i] * _b[k];
+      _b[i] = s / _L[i*_n+i];
+    }
+  }
+
+  /**
+   * append a row/column to the Cholesky factor L of an m x m matrix, s.t.
+   * it becomes the factor of the (m+1) x (m+1) matrix [A k ; k^T kappa].
+   * L is stored packed row-wise, row i starts at i*(i+1)/2, s.t. appending
+   * costs O(m^2) without moving the existing factor.
+   *
+   * @param _Lp     packed lower triangular factor
+   * @param _m      current dimension
+   * @param _k      new column of size m
+   * @param _kappa  new diagonal element
+   * @return false if the extended matrix is not positive definite (L unchanged)
+   */
+  static bool choleskyAppendPacked(std::vector<double>& _Lp,int _m,const double* _k,double _kappa) {
+    std::vector<double> l(_k,_k+_m);
+    for(int i=0;i<_m;i++) {
+      const double* li = &_Lp[i*(i+1)/2];
+      l[i] = (l[i] - dot(li,&l[0],i)) / li[i];
+    }
+    double s = _kappa - dot(&l[0],&l[0],_m);
+    if(s <= 0.0) return false;
+    _Lp.insert(_Lp.end(),l.begin(),l.end());
+    _Lp.push_back(std::sqrt(s));
+    return true;
+  }
+
+  /**
+   * solve L * L^T x = b for a packed Cholesky factor L
+   *
+   * @param _Lp  packed lower triangular factor
+   * @param _m   dimension
+   * @param _b   on input right hand side, on output the solution
+   */
+  static void choleskySolvePacked(const double* _Lp,int _m,double* _b) {
+    forwardSubstPacked(_Lp,_m,_b);
+    for(int i=_m-1;i>=0;i--) {
+      double s = _b[i];
+      for(int k=i+1;k<_m;k++) s -= _Lp[k*(k+1)/2+i] * _b[k];
+      _b[i] = s / _Lp[i*(i+1)/2+i];
+    }
+  }
+
+  /**
+   * solve L * x = b for a packed lower triangular L
+   *
+   * @param _Lp  packed lower triangular matrix
+   * @param _m   dimension
+   * @param _b   on input right hand side, on output the solution
+   */
+  static void forwardSubstPacked(const double* _Lp,int _m,double* _b) {
+    for(int i=0;i<_m;i++) {
+      const double* li = _Lp + i*(i+1)/2;
+      _b[i] = (_b[i] - dot(li,_b,i)) / li[i];
+    }
+  }
+
+  /**
+   * solve L * x = b for a lower triangular L
+   *
+   * @param _n  dimension
+   * @param _L  n x n lower triangular matrix
+   * @param _b  on input right hand side, on output the solution
+   */
+  static void forwardSubst(int _n,const double* _L,double* _b) {
+    for(int i=0;i<_n;i++) {
+      const double* li = _L + i*_n;
+      _b[i] = (_b[i] - dot(li,_b,i)) / li[i];
+    }
+  }
+
+  /**
+   * in-place inversion of a general (e.g. symmetric indefinite) matrix by
+   * Gauss-Jordan elimination with partial pivoting
+   *
+   * @param _n    dimension
+   * @param _A    n x n matrix, on output its inverse
+   * @param _tol  pivots below _tol times the largest element are singular
+   * @return false if the matrix is numerically singular (A undefined)
+   */
+  static bool invert(int _n,double* _A,double _tol=1e-14) {
+    std::vector<int> perm(_n);
+    double amax = 0.0;
+    for(int i=0;i<_n*_n;i++) amax = std::max(amax,std::fabs(_A[i]));
+    for(int j=0;j<_n;j++) {
+      int p = j;
+      for(int i=j+1;i<_n;i++)
+	if(std::fabs(_A[i*_n+j]) > std::fabs(_A[p*_n+j])) p = i;
+      perm[j] = p;
+      if(!(std::fabs(_A[p*_n+j]) > _tol * amax)) return false;
+      if(p != j)
+	for(int k=0;k<_n;k++) std::swap(_A[j*_n+k],_A[p*_n+k]);
+      double* aj = _A + j*_n;
+      double piv = 1.0 / aj[j];
+      aj[j] = 1.0;
+      for(int k=0;k<_n;k++) aj[k] *= piv;
+      for(int i=0;i<_n;i++) {
+	if(i == j) continue;
+	double* ai = _A + i*_n;
+	double f = ai[j];
+	if(f == 0.0) continue;
+	ai[j] = 0.0;
+	for(int k=0;k<_n;k++) ai[k] -= f * aj[k];
+      }
+    }
+    // undo the row interchanges as column interchanges
+    for(int j=_n-1;j>=0;j--)
+      if(perm[j] != j)
+	for(int i=0;i<_n;i++) std::swap(_A[i*_n+j],_A[i*_n+perm[j]]);
+    return true;
+  }
+
+ private:
+
+  /** sqrt(a^2+b^2) without under/overflow */
+  static double hypot2(double _a,double _b) {
+    double a = std::fabs(_a), b = std::fabs(_b);
+    if(a > b) { double r = b/a; return a*std::sqrt(1.0+r*r); }
+    if(b > 0.0) { double r = a/b; return b*std::sqrt(1.0+r*r); }
+    return 0.0;
+  }
+
+  /** Householder reduction to tridiagonal form */
+  static void tred2(int n,double* V,double* d,double* e) {
+    for(int j=0;j<n;j++) d[j] = V[(n-1)*n+j];
+    for(int i=n-1;i>0;i--) {
+      double scale = 0.0, h = 0.0;
+      for(int k=0;k<i;k++) scale += std::fabs(d[k]);
+      if(scale == 0.0) {
+	e[i] = d[i-1];
+	for(int j=0;j<i;j++) {
+	  d[j] = V[(i-1)*n+j];
+	  V[i*n+j] = 0.0;
+	  V[j*n+i] = 0.0;
+	}
+      } else {
+	for(int k=0;k<i;k++) {
+	  d[k] /= scale;
+	  h += d[k] * d[k];
+	}
+	double f = d[i-1];
+	double g = std::sqrt(h);
+	if(f > 0) g = -g;
+	e[i] = scale * g;
+	h = h - f * g;
+	d[i-1] = f - g;
+	for(int j=0;j<i;j++) e[j] = 0.0;
+	for(int j=0;j<i;j++) {
+	  f = d[j];
+	  V[j*n+i] = f;
+	  g = e[j] + V[j*n+j] * f;
+	  for(int k=j+1;k<=i-1;k++) {
+	    g += V[k*n+j] * d[k];
+	    e[k] += V[k*n+j] * f;
+	  }
+	  e[j] = g;
+	}
+	f = 0.0;
+	for(int j=0;j<i;j++) {
+	  e[j] /= h;
+	  f += e[j] * d[j];
+	}
+	double hh = f / (h + h);
+	for(int j=0;j<i;j++) e[j] -= hh * d[j];
+	for(int j=0;j<i;j++) {
+	  f = d[j];
+	  g = e[j];
+	  for(int k=j;k<=i-1;k++) V[k*n+j] -= (f * e[k] + g * d[k]);
+	  d[j] = V[(i-1)*n+j];
+	  V[i*n+j] = 0.0;
+	}
+      }
+      d[i] = h;
+    }
+    // accumulate transformations
+    for(int i=0;i<n-1;i++) {
+      V[(n-1)*n+i] = V[i*n+i];
+      V[i*n+i] = 1.0;
+      double h = d[i+1];
+      if(h != 0.0) {
+	for(int k=0;k<=i;k++) d[k] = V[k*n+i+1] / h;
+	for(int j=0;j<=i;j++) {
+	  double g = 0.0;
+	  for(int k=0;k<=i;k++) g += V[k*n+i+1] * V[k*n+j];
+	  for(int k=0;k<=i;k++) V[k*n+j] -= g * d[k];
+	}
+      }
+      for(int k=0;k<=i;k++) V[k*n+i+1] = 0.0;
+    }
+    for(int j=0;j<n;j++) {
+      d[j] = V[(n-1)*n+j];
+      V[(n-1)*n+j] = 0.0;
+    }
+    V[(n-1)*n+n-1] = 1.0;
+    e[0] = 0.0;
+  }
+
+  /** QL algorithm on a symmetric tridiagonal matrix */
+  static void tql2(int n,double* V,double* d,double* e) {
+    for(int i=1;i<n;i++) e[i-1] = e[i];
+    e[n-1] = 0.0;
+    double f = 0.0, tst1 = 0.0;
+    const double eps = std::pow(2.0,-52.0);
+    for(int l=0;l<n;l++) {
+      tst1 = std::max(tst1,std::fabs(d[l]) + std::fabs(e[l]));
+      int m = l;
+      while(m < n) {
+	if(std::fabs(e[m]) <= eps*tst1) break;
+	m++;
+      }
+      if(m == n) m = n-1;
+      if(m > l) {
+	do {
+	  double g = d[l];
+	  double p = (d[l+1] - g) / (2.0 * e[l]);
+	  double r = hypot2(p,1.0);
+	  if(p < 0) r = -r;
+	  d[l] = e[l] / (p + r);
+	  d[l+1] = e[l] * (p + r);
+	  double dl1 = d[l+1];
+	  double h = g - d[l];
+	  for(int i=l+2;i<n;i++) d[i] -= h;
+	  f = f + h;
+	  p = d[m];
+	  double c = 1.0, c2 = c, c3 = c;
+	  double el1 = e[l+1];
+	  double s = 0.0, s2 = 0.0;
+	  for(int i=m-1;i>=l;i--) {
+	    c3 = c2;
+	    c2 = c;
+	    s2 = s;
+	    g = c * e[i];
+	    h = c * p;
+	    r = hypot2(p,e[i]);
+	    e[i+1] = s * r;
+	    s = e[i] / r;
+	    c = p / r;
+	    p = c * d[i] - s * g;
+	    d[i+1] = h + s * (c * g + s * d[i]);
+	    for(int k=0;k<n;k++) {
+	      h = V[k*n+i+1];
+	      V[k*n+i+1] = s * V[k*n+i] + c * h;
+	      V[k*n+i] = c * V[k*n+i] - s * h;
+	    }
+	  }
+	  p = -s * s2 * c3 * el1 * e[l] / dl1;
+	  e[l] = s * p;
+	  d[l] = c * p;
+	} while(std::fabs(e[l]) > eps*tst1);
+      }
+      d[l] = d[l] + f;
+      e[l] = 0.0;
+    }
+  }
+
+};
+
+#endif
@@ -0,0 +1,332 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _MappedDataset_h
+#define _MappedDataset_h
+
+#include <map>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <limits>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+
+#include "MappedFile.h"
+
+/**
+ * \file MappedDataset.h
+ * \class MappedDataset
+ *
+ * Read-only columnar dataset of doubles (e.g. measurement time series)
+ * mapped into memory. The pages are shared by all threads and, through
+ * the page cache, by all processes reading the same file.
+ *
+ * Layout (native byte order) :
+ *   char[8] magic "BBPEODAT", uint32 version, uint32 number of columns,
+ *   uint64 number of rows, uint64 offset of the first column,
+ *   char[NAMELENGTH] per column name,
+ *   columns of rows doubles, each starting at a multiple of 64 bytes
+ *
+ * Datasets are created from CSV files by MappedDataset::convertCSV().
+ *
+ * @date: Oct. 2026
+ */
+class MappedDataset {
+
+public:
+
+  /** file format version */
+  static const unsigned int VERSION = 1;
+
+  /** max. length of column names */
+  static const unsigned int NAMELENGTH = 64;
+
+  /// Cor.
+  MappedDataset() : base(0),length(0),numRows(0) { }
+
+  /// Destructor
+  ~MappedDataset() {
+    close();
+  }
+
+  /**
+   * map a dataset read-only
+   *
+   * @param _path file name
+   * @return false if the file is not a valid dataset
+   */
+  bool open(const std::string& _path) {
+    close();
+    if(!file.open(_path,false)) return false;
+    length = file.size();
+    if(length < sizeof(Header)) {
+      close();
+      return false;
+    }
+    base = (const char*) file.map(0,length);
+    const Header* h = (const Header*) base;
+    if(base == 0 || std::memcmp(h->magic,MAGIC(),8) != 0 || h->version != VERSION ||
+       h->offset + h->columns * paddedBytes(h->rows) > length) {
+      close();
+      return false;
+    }
+    numRows = h->rows;
+    names.clear();
+    columns.clear();
+    for(unsigned int j=0;j<h->columns;j++) {
+      const char* n = base + sizeof(Header) + j * NAMELENGTH;
+      names.push_back(std::string(n,strnlen(n,NAMELENGTH)));
+      columns.push_back((const double*) (base + h->offset + j * paddedBytes(numRows)));
+    }
+    return true;
+  }
+
+  /// unmap the dataset
+  void close() {
+    if(base != 0) MappedFile::unmap((void*) base,length);
+    base = 0;
+    length = 0;
+    numRows = 0;
+    names.clear();
+    columns.clear();
+    file.close();
+  }
+
+  /// @return whether a dataset is mapped
+  bool isOpen() const {
+    return base != 0;
+  }
+
+  /// @return number of rows
+  unsigned long long rows() const {
+    return numRows;
+  }
+
+  /// @return number of columns
+  unsigned int numColumns() const {
+    return columns.size();
+  }
+
+  /// @return name of the j-th column
+  const std::string& name(unsigned int _j) const {
+    return names[_j];
+  }
+
+  /**
+   * @param _name column name or its number
+   * @return index of the column, -1 if there is none
+   */
+  int columnIndex(const std::string& _name) const {
+    for(unsigned int j=0;j<names.size();j++)
+      if(names[j] == _name) return j;
+    char* end;
+    long j = std::strtol(_name.c_str(),&end,10);
+    if(!_name.empty() && *end == '\0' && j >= 0 && j < (long) columns.size()) return j;
+    return -1;
+  }
+
+  /// @return the j-th column (64 byte aligned)
+  const double* column(unsigned int _j) const {
+    return columns[_j];
+  }
+
+  /**
+   * map a dataset once per process, all callers share the mapping
+   *
+   * @param _path file name
+   * @return the dataset, 0 if the file is not a valid dataset
+   */
+  static const MappedDataset* shared(const std::string& _path) {
+    static std::map<std::string,MappedDataset*> datasets;
+    MappedDataset* d = 0;
+#ifdef _OPENMP
+#pragma omp critical(MappedDataset)
+#endif
+    {
+      std::map<std::string,MappedDataset*>::iterator it = datasets.find(_path);
+      if(it != datasets.end())
+	d = it->second;
+      else {
+	d = new MappedDataset();
+	if(!d->open(_path)) {
+	  delete d;
+	  d = 0;
+	} else
+	  datasets[_path] = d;
+      }
+    }
+    return d;
+  }
+
+  /**
+   * convert a CSV file into a dataset. A first line with non-numeric fields
+   * holds the column names, lines which are empty or start with '#' are
+   * skipped, missing or non-numeric fields are stored as NaN.
+   * The CSV file is read twice, s.t. the data is never held in memory.
+   *
+   * @param _csv        CSV file
+   * @param _path       dataset file to be written
+   * @param _delimiter  field delimiter
+   * @return false on i/o errors
+   */
+  static bool convertCSV(const std::string& _csv,const std::string& _path,char _delimiter=',') {
+    std::ifstream in(_csv.c_str());
+    if(!in) {
+      std::cerr << "convertCSV: cannot read " << _csv << std::endl;
+      return false;
+    }
+    // first pass: column names and number of rows
+    std::vector<std::string> header;
+    std::vector<std::string> fields;
+    std::string line;
+    unsigned long long rows = 0;
+    bool first = true;
+    while(std::getline(in,line)) {
+      if(skip(line)) continue;
+      if(first) {
+	first = false;
+	split(line,_delimiter,fields);
+	bool numeric = true;
+	for(unsigned int j=0;j<fields.size() && numeric;j++) numeric = isNumber(fields[j]);
+	if(!numeric) {
+	  header = fields;
+	  continue;
+	}
+	for(unsigned int j=0;j<fields.size();j++) {
+	  std::ostringstream os;
+	  os << j;
+	  header.push_back(os.str());
+	}
+      }
+      rows++;
+    }
+    unsigned int ncols = header.size();
+    unsigned long long offset = sizeof(Header) + ncols * NAMELENGTH;
+    offset = (offset + 63) / 64 * 64;
+    unsigned long long total = offset + ncols * paddedBytes(rows);
+
+    // second pass: write the columns directly into the mapped file
+    std::remove(_path.c_str());
+    MappedFile out;
+    char* p = 0;
+    if(!out.open(_path,true) || !out.grow(total) || (p = (char*) out.map(0,total)) == 0) {
+      std::cerr << "convertCSV: cannot write " << _path << std::endl;
+      return false;
+    }
+    Header* h = (Header*) p;
+    h->version = VERSION;
+    h->columns = ncols;
+    h->rows = rows;
+    h->offset = offset;
+    for(unsigned int j=0;j<ncols;j++)
+      std::strncpy(p + sizeof(Header) + j * NAMELENGTH,header[j].c_str(),NAMELENGTH-1);
+    in.clear();
+    in.seekg(0);
+    unsigned long long r = 0;
+    first = true;
+    while(r < rows && std::getline(in,line)) {
+      if(skip(line)) continue;
+      split(line,_delimiter,fields);
+      if(first) {
+	first = false;
+	bool numeric = true;
+	for(unsigned int j=0;j<fields.size() && numeric;j++) numeric = isNumber(fields[j]);
+	if(!numeric) continue;
+      }
+      for(unsigned int j=0;j<ncols;j++) {
+	double* col = (double*) (p + offset + j * paddedBytes(rows));
+	char* end = 0;
+	double v = j < fields.size() ? std::strtod(fields[j].c_str(),&end) : 0.0;
+	col[r] = (end != 0 && end != fields[j].c_str()) ? v : std::numeric_limits<double>::quiet_NaN();
+      }
+      r++;
+    }
+    // the magic is written last, an interrupted conversion is not a valid dataset
+    std::memcpy(h->magic,MAGIC(),8);
+    MappedFile::flush(p,total);
+    MappedFile::unmap(p,total);
+    return true;
+  }
+
+ private:
+
+  /// file header, followed by the column names
+  struct Header {
+    char                 magic[8];
+    unsigned int         version;
+    unsigned int         columns;
+    unsigned long long   rows;
+    unsigned long long   offset;
+  };
+
+  static const char* MAGIC() {
+    return "BBPEODAT";
+  }
+
+  /// bytes of a column padded to 64 bytes
+  static unsigned long long paddedBytes(unsigned long long _rows) {
+    return (8ULL * _rows + 63) / 64 * 64;
+  }
+
+  static bool skip(const std::string& _line) {
+    std::string::size_type i = _line.find_first_not_of(" \t\r");
+    return i == std::string::npos || _line[i] == '#';
+  }
+
+  static bool isNumber(const std::string& _s) {
+    char* end;
+    std::strtod(_s.c_str(),&end);
+    return end != _s.c_str();
+  }
+
+  /// split a line into trimmed fields
+  static void split(const std::string& _line,char _delimiter,std::vector<std::string>& _fields) {
+    _fields.clear();
+    std::string::size_type start = 0;
+    for(;;) {
+      std::string::size_type end = _line.find(_delimiter,start);
+      std::string f = _line.substr(start,end == std::string::npos ? std::string::npos : end - start);
+      std::string::size_type a = f.find_first_not_of(" \t\r\"");
+      std::string::size_type b = f.find_last_not_of(" \t\r\"");
+      _fields.push_back(a == std::string::npos ? std::string("") : f.substr(a,b-a+1));
+      if(end == std::string::npos) break;
+      start = end + 1;
+    }
+  }
+
+  /// prevent copy cor
+  MappedDataset(const MappedDataset&);
+
+  /// prevent copy assignment
+  MappedDataset& operator=(const MappedDataset&);
+
+  MappedFile                  file;     ///> mapped file
+  const char*                 base;     ///> mapped file content
+  unsigned long long          length;   ///> size of the file
+  unsigned long long          numRows;  ///> number of rows
+  std::vector<std::string>    names;    ///> column names
+  std::vector<const double*>  columns;  ///> columns
+};
+
+#endif
@@ -0,0 +1,225 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _MappedFile_h
+#define _MappedFile_h
+
+#include <string>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/**
+ * \file MappedFile.h
+ * \class MappedFile
+ *
+ * Thin portable wrapper (POSIX / Win32) of a file whose regions are mapped
+ * into memory. Regions are mapped independently, s.t. the file can grow
+ * while previously mapped regions stay valid. Offsets of regions must be
+ * multiples of MappedFile::ALIGNMENT.
+ *
+ * @date: Oct. 2026
+ */
+class MappedFile {
+
+public:
+
+  /** alignment of mapped regions (covers page size and windows allocation granularity) */
+  static const unsigned long ALIGNMENT = 65536;
+
+  /// Cor.
+  MappedFile() : writable(false) {
+#ifdef _WIN32
+    handle = INVALID_HANDLE_VALUE;
+#else
+    fd = -1;
+#endif
+  }
+
+  /// Destructor, mapped regions have to be unmapped before
+  ~MappedFile() {
+    close();
+  }
+
+  /**
+   * open (and create) a file
+   *
+   * @param _path      file name
+   * @param _writable  read-write (created if necessary) or read-only
+   * @return false on failure
+   */
+  bool open(const std::string& _path,bool _writable) {
+    close();
+    writable = _writable;
+#ifdef _WIN32
+    handle = CreateFileA(_path.c_str(),
+			 _writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+			 FILE_SHARE_READ | FILE_SHARE_WRITE,0,
+			 _writable ? OPEN_ALWAYS : OPEN_EXISTING,
+			 FILE_ATTRIBUTE_NORMAL,0);
+    return handle != INVALID_HANDLE_VALUE;
+#else
+    fd = ::open(_path.c_str(),_writable ? (O_RDWR | O_CREAT) : O_RDONLY,0644);
+    return fd >= 0;
+#endif
+  }
+
+  /// @return whether a file is open
+  bool isOpen() const {
+#ifdef _WIN32
+    return handle != INVALID_HANDLE_VALUE;
+#else
+    return fd >= 0;
+#endif
+  }
+
+  /// close the file
+  void close() {
+#ifdef _WIN32
+    if(handle != INVALID_HANDLE_VALUE) CloseHandle(handle);
+    handle = INVALID_HANDLE_VALUE;
+#else
+    if(fd >= 0) ::close(fd);
+    fd = -1;
+#endif
+  }
+
+  /// @return current size of the file in bytes
+  unsigned long long size() const {
+#ifdef _WIN32
+    LARGE_INTEGER s;
+    if(!GetFileSizeEx(handle,&s)) return 0;
+    return s.QuadPart;
+#else
+    struct stat st;
+    if(fstat(fd,&st) != 0) return 0;
+    return st.st_size;
+#endif
+  }
+
+  /**
+   * grow the file (new bytes are zero), never shrinks
+   *
+   * @return false on failure
+   */
+  bool grow(unsigned long long _size) {
+    if(_size <= size()) return true;
+#ifdef _WIN32
+    LARGE_INTEGER s;
+    s.QuadPart = _size;
+    return SetFilePointerEx(handle,s,0,FILE_BEGIN) && SetEndOfFile(handle);
+#else
+    return ftruncate(fd,_size) == 0;
+#endif
+  }
+
+  /**
+   * map a region of the file
+   *
+   * @param _offset  offset, multiple of ALIGNMENT
+   * @param _length  length in bytes, the region must lie within the file
+   * @return address of the region, 0 on failure
+   */
+  void* map(unsigned long long _offset,unsigned long _length) {
+#ifdef _WIN32
+    HANDLE mapping = CreateFileMappingA(handle,0,writable ? PAGE_READWRITE : PAGE_READONLY,
+					(DWORD) ((_offset + _length) >> 32),
+					(DWORD) ((_offset + _length) & 0xFFFFFFFFUL),0);
+    if(mapping == 0) return 0;
+    void* p = MapViewOfFile(mapping,writable ? FILE_MAP_WRITE : FILE_MAP_READ,
+			    (DWORD) (_offset >> 32),(DWORD) (_offset & 0xFFFFFFFFUL),_length);
+    // the view keeps the mapping object alive
+    CloseHandle(mapping);
+    return p;
+#else
+    void* p = mmap(0,_length,writable ? (PROT_READ | PROT_WRITE) : PROT_READ,MAP_SHARED,fd,_offset);
+    return p == MAP_FAILED ? 0 : p;
+#endif
+  }
+
+  /**
+   * unmap a region
+   */
+  static void unmap(void* _address,unsigned long _length) {
+    if(_address == 0) return;
+#ifdef _WIN32
+    UnmapViewOfFile(_address);
+#else
+    munmap(_address,_length);
+#endif
+  }
+
+  /**
+   * flush a mapped region to the disk (asynchronously)
+   */
+  static void flush(void* _address,unsigned long _length) {
+    if(_address == 0) return;
+#ifdef _WIN32
+    FlushViewOfFile(_address,_length);
+#else
+    msync(_address,_length,MS_ASYNC);
+#endif
+  }
+
+  /**
+   * @return wall clock time in seconds since 1970
+   */
+  static double wallTime() {
+#ifdef _WIN32
+    FILETIME ft;
+    GetSystemTimeAsFileTime(&ft);
+    unsigned long long t = ((unsigned long long) ft.dwHighDateTime << 32) | ft.dwLowDateTime;
+    // 100ns intervals since 1601
+    return t * 1e-7 - 11644473600.0;
+#else
+    struct timeval tv;
+    gettimeofday(&tv,0);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+#endif
+  }
+
+ private:
+
+  /// prevent copy cor
+  MappedFile(const MappedFile&);
+
+  /// prevent copy assignment
+  MappedFile& operator=(const MappedFile&);
+
+  bool writable;    ///> whether the file is opened read-write
+#ifdef _WIN32
+  HANDLE handle;    ///> file handle
+#else
+  int    fd;        ///> file descriptor
+#endif
+};
+
+#endif
@@ -0,0 +1,143 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _ParallelEval_h
+#define _ParallelEval_h
+
+#include <vector>
+#include <eo>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * \file ParallelEval.h
+ * \class ParallelEval
+ *
+ * Evaluation of a batch of candidate solutions on the OpenMP worker pool.
+ * Without -fopenmp the batch is evaluated sequentially.
+ *
+ * The objective function is called concurrently, i.e. eval() of the
+ * objective must be reentrant (true for all functions in objfunc/).
+ * Either the raw objective function is called and a plain eoEvalFuncCounter
+ * is incremented once per batch by the calling thread, or a thread-safe
+ * evaluator (e.g. eoParallelEvalFuncCounter) is called directly.
+ *
+ * @date: Oct. 2026
+ */
+class ParallelEval {
+
+public:
+
+  /**
+   * set the number of worker threads
+   *
+   * @param _nthreads number of threads
+   */
+  static void setNumThreads(int _nthreads) {
+#ifdef _OPENMP
+    if(_nthreads > 0) omp_set_num_threads(_nthreads);
+#endif
+  }
+
+  /**
+   * @return number of worker threads
+   */
+  static int numThreads() {
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+  /**
+   * @return id of the calling worker thread
+   */
+  static int threadId() {
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+  }
+
+  /**
+   * evaluate all invalid individuals of a batch
+   *
+   * @param _batch    candidate solutions
+   * @param _func     objective function
+   * @param _counter  evaluation counter to be updated
+   * @return number of evaluations
+   */
+  template<class EOT>
+  static unsigned evaluate(std::vector<EOT>& _batch,eoEvalFunc<EOT>& _func,eoEvalFuncCounter<EOT>& _counter) {
+    std::vector<EOT*> todo;
+    todo.reserve(_batch.size());
+    for(unsigned i=0;i<_batch.size();i++)
+      if(_batch[i].invalid()) todo.push_back(&_batch[i]);
+    return evaluate(todo,_func,_counter);
+  }
+
+  /**
+   * evaluate all invalid individuals referenced by a batch of pointers
+   *
+   * @param _batch    pointers to candidate solutions
+   * @param _func     objective function
+   * @param _counter  evaluation counter to be updated
+   * @return number of evaluations
+   */
+  template<class EOT>
+  static unsigned evaluate(std::vector<EOT*>& _batch,eoEvalFunc<EOT>& _func,eoEvalFuncCounter<EOT>& _counter) {
+    int n = _batch.size();
+    unsigned cntr = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,1) reduction(+:cntr)
+#endif
+    for(int i=0;i<n;i++) {
+      if(_batch[i]->invalid()) {
+	_func(*_batch[i]);
+	cntr++;
+      }
+    }
+    _counter.value() += cntr;
+    return cntr;
+  }
+
+  /**
+   * evaluate all invalid individuals of a batch with a thread-safe evaluator
+   *
+   * @param _batch    candidate solutions
+   * @param _eval     thread-safe evaluator, e.g. eoParallelEvalFuncCounter
+   */
+  template<class EOT>
+  static void evaluate(std::vector<EOT>& _batch,eoEvalFunc<EOT>& _eval) {
+    int n = _batch.size();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+    for(int i=0;i<n;i++)
+      _eval(_batch[i]);
+  }
+
+};
+
+#endif
@@ -0,0 +1,208 @@
+/**
+    Copyright (C) Atiyah Elsheikh (Atiyah.Elsheikh@ait.ac.at,a.m.g.Elsheikh@gmail.com) 2014,2015
+    AIT Austrian Institute of Technology GmbH
+
+    This file is part of the software blackboxParadisEO
+
+    blackboxParadisEO is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    blackboxParadisEO is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with blackboxParadisEO.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef _Sobol_h
+#define _Sobol_h
+
+#include <vector>
+#include <stdint.h>
+
+/**
+ * \file Sobol.h
+ * \class Sobol
+ *
+ * Digitally shifted Sobol sequence in [0,1)^d with 32 bit resolution.
+ *
+ * - the primitive polynomials over GF(2) are enumerated by increasing
+ *   degree, a polynomial of degree s is primitive iff x has the order
+ *   2^s-1 modulo the polynomial
+ * - the initial direction numbers are odd numbers drawn by a fixed
+ *   generator, s.t. the sequence only depends on the dimension
+ * - consecutive points are generated in Gray code order, i.e. one XOR of
+ *   a direction number per coordinate and point
+ * - a digital shift (XOR of a random 32 bit word per coordinate) keeps the
+ *   net properties and randomizes the sequence
+ *
+ * Coordinates beyond MAXDIM are not generated.
+ *
+ * @date: Oct. 2026
+ */
+class Sobol {
+
+public:
+
+  /** max. number of generated coordinates */
+  static const unsigned MAXDIM = 4096;
+
+  /** number of bits */
+  static const unsigned BITS = 32;
+
+  /**
+   * Constructor
+   *
+   * @param _dim  dimension (at most MAXDIM)
+   */
+  Sobol(unsigned _dim=0) : dim(0),index(0) {
+    resize(_dim);
+  }
+
+  /**
+   * set the dimension, the direction numbers are extended on demand
+   *
+   * @param _dim  dimension (at most MAXDIM)
+   */
+  void resize(unsigned _dim) {
+    if(_dim > MAXDIM) _dim = MAXDIM;
+    if(_dim > dim) {
+      direction.resize(_dim * BITS);
+      for(unsigned j=dim;j<_dim;j++) directionNumbers(j,&direction[j * BITS]);
+    }
+    dim = _dim;
+    state.assign(dim,0);
+    index = 0;
+  }
+
+  /// @return dimension
+  unsigned size() const {
+    return dim;
+  }
+
+  /**
+   * restart the sequence with a digital shift
+   *
+   * @param _shift  one 32 bit word per coordinate (empty: no shift)
+   */
+  void restart(const std::vector<uint32_t>& _shift) {
+    for(unsigned j=0;j<dim;j++) state[j] = j < _shift.size() ? _shift[j] : 0;
+    index = 0;
+  }
+
+  /**
+   * next point of the sequence
+   *
+   * @param _u  dim coordinates in [0,1)
+   */
+  void next(double* _u) {
+    for(unsigned j=0;j<dim;j++) _u[j] = state[j] * (1.0 / 4294967296.0);
+    // Gray code: the bit changing from index to index + 1 is the lowest zero bit of index
+    unsigned c = 0;
+    for(uint32_t i=index;i & 1U;i>>=1) c++;
+    if(c < BITS) {
+      const uint32_t* v = &direction[c];
+      for(unsigned j=0;j<dim;j++) state[j] ^= v[j * BITS];
+    }
+    index++;
+  }
+
+ protected:
+
+  /**
+   * direction numbers of coordinate _j
+   */
+  void directionNumbers(unsigned _j,uint32_t* _v) {
+    if(_j == 0) {
+      for(unsigned k=0;k<BITS;k++) _v[k] = 1U << (BITS - 1 - k);
+      return;
+    }
+    while(polynomials.size() < _j) nextPolynomial();
+    uint32_t p = polynomials[_j - 1];
+    unsigned s = degree(p);
+    // random odd initial numbers m_k < 2^k, k = 1..s
+    uint64_t seed = 0x9E3779B97F4A7C15ULL * (_j + 1);
+    for(unsigned k=0;k<s && k<BITS;k++) {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      uint32_t m = (uint32_t) (seed >> 33) & ((1U << (k + 1)) - 1);
+      _v[k] = (m | 1U) << (BITS - 1 - k);
+    }
+    // v_k = v_{k-s} ^ (v_{k-s} >> s) ^ sum a_l v_{k-l}
+    uint32_t a = (p >> 1) & ((1U << (s - 1)) - 1);
+    for(unsigned k=s;k<BITS;k++) {
+      uint32_t v = _v[k - s] ^ (_v[k - s] >> s);
+      for(unsigned l=1;l<s;l++)
+	if((a >> (s - 1 - l)) & 1U) v ^= _v[k - l];
+      _v[k] = v;
+    }
+  }
+
+  /**
+   * append the next primitive polynomial
+   */
+  void nextPolynomial() {
+    uint32_t p = polynomials.empty() ? 2U : polynomials.back();
+    for(;;) {
+      p++;
+      unsigned s = degree(p);
+      if(!(p & 1U) || s == 0) continue;
+      if(primitive(p,s)) break;
+    }
+    polynomials.push_back(p);
+  }
+
+  /// degree of a polynomial
+  static unsigned degree(uint32_t _p) {
+    unsigned s = 0;
+    while(_p >> (s + 1)) s++;
+    return s;
+  }
+
+  /// _a * _b modulo _p of degree _s
+  static uint32_t mulMod(uint32_t _a,uint32_t _b,uint32_t _p,unsigned _s) {
+    uint32_t r = 0;
+    for(;_b;_b>>=1) {
+      if(_b & 1U) r ^= _a;
+      _a <<= 1;
+      if((_a >> _s) & 1U) _a ^= _p;
+    }
+    return r;
+  }
+
+  /// x^_e modulo _p of degree _s
+  static uint32_t powX(uint64_t _e,uint32_t _p,unsigned _s) {
+    uint32_t r = 1, b = _s > 1 ? 2U : (2U ^ _p);
+    for(;_e;_e>>=1) {
+      if(_e & 1U) r = mulMod(r,b,_p,_s);
+      b = mulMod(b,b,_p,_s);
+    }
+    return r;
+  }
+
+  /// whether _p of degree _s is primitive
+  static bool primitive(uint32_t _p,unsigned _s) {
+    uint64_t order = (1ULL << _s) - 1;
+    if(powX(order,_p,_s) != 1) return false;
+    uint64_t n = order;
+    for(uint64_t q=2;q*q<=n;q++) {
+      if(n % q) continue;
+      if(powX(order / q,_p,_s) == 1) return false;
+      while(n % q == 0) n /= q;
+    }
+    if(n > 1 && n < order && powX(order / n,_p,_s) == 1) return false;
+    return true;
+  }
+
+  unsigned              dim;          ///> dimension
+  uint32_t              index;        ///> index of the next point
+  std::vector<uint32_t> state;        ///> next point
+  std::vector<uint32_t> direction;    ///> direction numbers (dim x BITS)
+  std::vector<uint32_t> polynomials;  ///> primitive polynomials of the coordinates 1,2,...
+
+};
+
+#endif